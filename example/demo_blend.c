@@ -0,0 +1,24 @@
+#include "soft.h"
+
+int main(int argc, char** argv) {
+    softInit(1024, 768, softTextFormat("Soft %s", SOFT_VERSION));
+
+    while(!softWindowShoulClose()) {
+        softSetBlendMode(BLEND_REPLACE);
+        softClearBufferColor(BLACK);
+
+        softSetBlendMode(BLEND_ADDITIVE);
+        for(i32 i = 0; i < 8; i++) {
+            softDrawCircle((Circle) { softGetMousePosition(), 16 + i * 12 }, softPixelFade(RED, 0.15f));
+        }
+
+        softSetBlendMode(BLEND_ALPHA);
+        softDrawRectangle((Rect) { softVectorSub(softGetWindowCenter(), (iVec2) { 64, 64 }), { 128, 128 } }, softPixelFade(BLUE, 0.5f));
+
+        softBlit();
+    }
+
+    softClose();
+
+    return 0;
+}
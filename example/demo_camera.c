@@ -0,0 +1,38 @@
+#include "soft.h"
+
+int main(int argc, char** argv) {
+    softInit(1024, 768, softTextFormat("Soft %s", SOFT_VERSION));
+
+    Camera2D camera = { softGetWindowCenter(), softVectorZero(), 0.0f, 1.0f };
+
+    while(!softWindowShoulClose()) {
+        if(softKeyDown(KEY_LEFT))   camera.target.x -= 4;
+        if(softKeyDown(KEY_RIGHT))  camera.target.x += 4;
+        if(softKeyDown(KEY_UP))     camera.target.y -= 4;
+        if(softKeyDown(KEY_DOWN))   camera.target.y += 4;
+        if(softKeyDown(KEY_Q))      camera.rotation -= 1.0f;
+        if(softKeyDown(KEY_E))      camera.rotation += 1.0f;
+
+        camera.zoom += softGetMouseWheel().y * 0.1f;
+        camera.zoom = camera.zoom < 0.1f ? 0.1f : camera.zoom;
+
+        softClearBufferColor(BLACK);
+
+        // Only the handful of tiles inside of the view reach the rasterizer; the rest is culled.
+        softBeginMode2D(camera);
+        for(i32 y = -256; y < 256; y++) {
+            for(i32 x = -256; x < 256; x++) {
+                softDrawRectangle((Rect) { { x * 32, y * 32 }, { 30, 30 } }, (x + y) % 2 ? BLUE : RED);
+            }
+        }
+
+        softDrawCircle((Circle) { softGetScreenToWorld2D(softGetMousePosition(), camera), 8 }, WHITE);
+        softEndMode2D();
+
+        softBlit();
+    }
+
+    softClose();
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#include "soft.h"
+
+int main(int argc, char** argv) {
+    softInit(1024, 768, softTextFormat("Soft %s", SOFT_VERSION));
+
+    iVec2 chart[256];
+    f32 width = 4.0f;
+
+    while(!softWindowShoulClose()) {
+        if(softKeyPressed(KEY_J))   softSetLineJoin((softGetLineJoin() + 1) % 3);
+        if(softKeyPressed(KEY_C))   softSetLineCap((softGetLineCap() + 1) % 3);
+
+        width += softGetMouseWheel().y;
+        width = width < 1.0f ? 1.0f : width;
+
+        for(i32 i = 0; i < 256; i++) {
+            chart[i] = (iVec2) { 64 + i * 3, 200 + (i32)(80.0f * sinf(i * 0.15f + softTime())) + (i % 7) * 4 };
+        }
+
+        softClearBufferColor(BLACK);
+
+        softDrawLineStripStroke(chart, 256, width, 0xC000FFFF);
+        softDrawLineBezierCubicStroke((iVec2) { 64, 600 }, softGetMousePosition(), (iVec2) { 300, 360 }, (iVec2) { 600, 760 }, width, 0xC0FF8000);
+        softDrawRectangleStroke((Rect) { { 860, 400 }, { 120, 80 } }, width, RED);
+        softDrawCircleStroke((Circle) { { 920, 600 }, 60 }, width, GREEN);
+
+        softBlit();
+    }
+
+    softClose();
+
+    return 0;
+}
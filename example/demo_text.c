@@ -0,0 +1,27 @@
+#include "soft.h"
+
+int main(int argc, char** argv) {
+    softInit(1024, 768, softTextFormat("Soft %s", SOFT_VERSION));
+
+    i32 size = 16;
+
+    while(!softWindowShoulClose()) {
+        size += (i32)(softGetMouseWheel().y) * 8;
+        size = size < 8 ? 8 : size > 64 ? 64 : size;
+
+        const string label = softTextFormat("FPS: %i\nSize: %ipx", softFPS(), size);
+        iVec2 extent = softMeasureText(label, size);
+
+        softClearBufferColor(BLACK);
+
+        softDrawRectangle((Rect) { { 16, 16 }, { extent.x + 16, extent.y + 16 } }, 0x80404040);
+        softDrawText(label, (iVec2) { 24, 24 }, size, WHITE);
+        softDrawText("The quick brown fox jumps over the lazy dog.", softGetMousePosition(), size, 0xC000FFFF);
+
+        softBlit();
+    }
+
+    softClose();
+
+    return 0;
+}
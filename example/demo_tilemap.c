@@ -0,0 +1,70 @@
+#include "soft.h"
+
+#include <stdlib.h>
+
+int main(int argc, char** argv) {
+    softInit(1024, 768, softTextFormat("Soft %s", SOFT_VERSION));
+
+    // Four 32x32 tiles: two shades of grass, water and a half-transparent bush.
+    const Pixel colors[4] = { 0xFF2E8B3C, 0xFF3CA04A, 0xFFB06020, 0x8020C040 };
+    Image tiles[4] = { 0 };
+
+    for(i32 i = 0; i < 4; i++) {
+        tiles[i] = (Image) { (PixelBuffer)malloc(32 * 32 * sizeof(Pixel)), { 32, 32 }, 4, NULL };
+
+        for(i32 p = 0; p < 32 * 32; p++) {
+            tiles[i].data[p] = (p / 32 + p % 32) % 8 ? colors[i] : colors[i] | 0x00202020;
+        }
+    }
+
+    Atlas atlas = softLoadAtlas(tiles, 4, (iVec2) { 128, 128 });
+
+    // The ground never changes, so it's drawn from pre-rendered chunks; the bushes are drawn tile by tile.
+    Tilemap* ground = softLoadTilemap(&atlas, NULL, (iVec2) { 256, 256 }, (iVec2) { 32, 32 }, true);
+    Tilemap* bushes = softLoadTilemap(&atlas, NULL, (iVec2) { 256, 256 }, (iVec2) { 32, 32 }, false);
+
+    for(i32 y = 0; y < 256; y++) {
+        for(i32 x = 0; x < 256; x++) {
+            softSetTile(ground, (iVec2) { x, y }, (x / 16 + y / 16) % 5 == 0 ? 2 : (x ^ y) & 1);
+            softSetTile(bushes, (iVec2) { x, y }, rand() % 7 == 0 ? 3 : -1);
+        }
+    }
+
+    Camera2D camera = { softGetWindowCenter(), { 4096, 4096 }, 0.0f, 1.0f };
+
+    while(!softWindowShoulClose()) {
+        if(softKeyDown(KEY_LEFT))   camera.target.x -= 8;
+        if(softKeyDown(KEY_RIGHT))  camera.target.x += 8;
+        if(softKeyDown(KEY_UP))     camera.target.y -= 8;
+        if(softKeyDown(KEY_DOWN))   camera.target.y += 8;
+
+        // Clicking turns a tile into water: only the chunk holding it is rendered again.
+        if(softMouseButtonDown(BUTTON_LEFT)) {
+            iVec2 world = softGetScreenToWorld2D(softGetMousePosition(), camera);
+            softSetTile(ground, (iVec2) { world.x / 32, world.y / 32 }, 2);
+        }
+
+        softClearBufferColor(BLACK);
+
+        softBeginMode2D(camera);
+        softDrawTilemap(ground, softVectorZero(), WHITE);
+        softDrawTilemap(bushes, softVectorZero(), WHITE);
+        softEndMode2D();
+
+        softDrawText(softTextFormat("FPS: %i", softFPS()), (iVec2) { 16, 16 }, 16, WHITE);
+
+        softBlit();
+    }
+
+    softUnloadTilemap(bushes);
+    softUnloadTilemap(ground);
+    softUnloadAtlas(&atlas);
+
+    for(i32 i = 0; i < 4; i++) {
+        softUnloadImage(&tiles[i]);
+    }
+
+    softClose();
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "soft.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Replays a recording made with softBeginRecording / softEndRecording as fast as possible, without a window,
+// and reports its frame times. Usage: replay <recording> [runs]
+
+static int compareTimes(const void* a, const void* b) {
+    f32 x = *(const f32*)a;
+    f32 y = *(const f32*)b;
+
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) {
+        printf("Usage: %s <recording> [runs]\n", argv[0]);
+        return 1;
+    }
+
+    i32 runs = argc > 2 ? atoi(argv[2]) : 1;
+    runs = runs > 0 ? runs : 1;
+    i32 frames = softReplayRecording(argv[1], NULL, 0);
+
+    if(frames <= 0) {
+        return 1;
+    }
+
+    // Every frame time of every run is kept, so their count has to fit both the indices and the allocation.
+    if(runs > INT32_MAX / frames || (size_t)(frames) * runs > SIZE_MAX / sizeof(f32)) {
+        printf("Too many runs: %i (%i frames each)\n", runs, frames);
+        return 1;
+    }
+
+    // The first pass only warmed up the caches and the default fonts; the timed ones follow.
+    f32* times = (f32*)malloc((size_t)(frames) * runs * sizeof(f32));
+
+    if(!times) {
+        printf("Frame times could not be allocated: %i frames x %i runs\n", frames, runs);
+        return 1;
+    }
+
+    for(i32 run = 0; run < runs; run++) {
+        softReplayRecording(argv[1], times + run * frames, frames);
+    }
+
+    i32 count = frames * runs;
+    f32 total = 0.0f;
+
+    for(i32 i = 0; i < count; i++) {
+        total += times[i];
+    }
+
+    qsort(times, count, sizeof(f32), compareTimes);
+
+    printf("%s: %i frames x %i runs\n", argv[1], frames, runs);
+    printf("   > mean: %.3f ms\n", total / count * 1000.0f);
+    printf("   > p50:  %.3f ms\n", times[(count * 50 + 99) / 100 - 1] * 1000.0f);
+    printf("   > p95:  %.3f ms\n", times[(count * 95 + 99) / 100 - 1] * 1000.0f);
+    printf("   > p99:  %.3f ms\n", times[(count * 99 + 99) / 100 - 1] * 1000.0f);
+    printf("   > max:  %.3f ms\n", times[count - 1] * 1000.0f);
+
+    free(times);
+    softUnloadPixelBuffer();
+
+    return 0;
+}
@@ -20,6 +20,7 @@
 // - SOFT_API_FUNC_EVENTS;
 // - SOFT_API_FUNC_INPUT;
 // - SOFT_API_FUNC_RENDER;
+// - SOFT_API_FUNC_MEMORY;
 // - SOFT_API_FUNC_DRAW;
 // - SOFT_API_FUNC_LOGGING;
 // - SOFT_API_FUNC_TEXT;
@@ -27,6 +28,10 @@
 // - SOFT_API_FUNC_TIME;
 // - SOFT_API_FUNC_MATH;
 // - SOFT_API_FUNC_IMAGE;
+// - SOFT_API_FUNC_FONT;
+// - SOFT_API_FUNC_PACK;
+// - SOFT_API_FUNC_TILEMAP;
+// - SOFT_API_FUNC_RECORDING;
 // ---------------------------------------------------------------------------------
 // External Dependencies:
 // - SDL2: https://github.com/libsdl-org/SDL.git
@@ -85,6 +90,22 @@
 #include <errno.h>
 #include <math.h>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+// Memory mapping (asset packs)
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
 // Dependency headers
 #include "SDL.h"
 #include "SDL_events.h"
@@ -96,6 +117,10 @@
 #include "SDL_pixels.h"
 #include "SDL_version.h"
 
+// stb_image allocates with the C allocator, so decoded buffers can be adopted by Image (and freed by softUnloadImage).
+#define STBI_MALLOC(size) malloc(size)
+#define STBI_REALLOC(pointer, size) realloc(pointer, size)
+#define STBI_FREE(pointer) free(pointer)
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
@@ -110,6 +135,49 @@
 #define SOFT_CHARBUF_SIZE_MAX 256
 #define SOFT_KEYCODE_COUNT_TOTAL 128
 #define SOFT_MOUSEBUTTON_COUNT_TOTAL 3
+#define SOFT_SPAN_CHUNK_SIZE 256
+#define SOFT_CLIP_STACK_SIZE_MAX 32
+#define SOFT_COVERAGE_SPAN_MIN 8
+#define SOFT_TRIANGLE_BLOCK_SIZE 8
+#define SOFT_TRIANGLE_COORD_MAX (1 << 23)
+#define SOFT_POLYGON_COORD_MAX (1 << 20)
+#define SOFT_SUBPIXEL_SHIFT 8
+#define SOFT_SUBPIXEL_ONE (1 << SOFT_SUBPIXEL_SHIFT)
+#define SOFT_CURVE_TOLERANCE 0.25
+#define SOFT_CURVE_SEGMENTS_MAX 1024
+#define SOFT_STROKE_MITER_LIMIT 4.0
+#define SOFT_FONT_DEFAULT_SIZE 8
+#define SOFT_FONT_DEFAULT_SCALE_MAX 8
+#define SOFT_LOADER_WORKERS_MAX 4
+#define SOFT_PACK_MAGIC 0x4B505453     // "STPK"
+#define SOFT_PACK_VERSION 1
+#define SOFT_PACK_ALIGNMENT 64
+#define SOFT_PACK_NAME_SIZE 104
+#define SOFT_PACK_COUNT_MAX 16
+#define SOFT_RESOURCE_TABLE_EMPTY (-1)
+#define SOFT_RESOURCE_TABLE_DELETED (-2)
+#define SOFT_RUN_SHIFT 30
+#define SOFT_RUN_LENGTH_MASK ((1u << SOFT_RUN_SHIFT) - 1)
+#define SOFT_RUN_LENGTH_MIN 8
+#define SOFT_TILEMAP_CHUNK_SIZE 256
+#define SOFT_DEFERRED_TILE_SIZE 16
+#define SOFT_FRAME_TIME_WINDOW 256
+#define SOFT_RECORDING_MAGIC 0x43455253    // "SREC"
+#define SOFT_RECORDING_VERSION 1
+#define SOFT_RECORD_DEFINITION 0x80000000  // Image and font ids: the definition follows
+#define SOFT_RECORD_DEFAULT_FONT 0x40000000  // Font ids: the default font of the scale in the low bits
+#define SOFT_ARENA_BLOCK_SIZE (64 * 1024)
+#define SOFT_ARENA_ALIGNMENT 16
+#define SOFT_ARENA_ALIGN(size) (((size) + SOFT_ARENA_ALIGNMENT - 1) & ~(size_t)(SOFT_ARENA_ALIGNMENT - 1))
+
+// 32.32 fixed-point (i64)
+#define SOFT_FIXED_SHIFT 32
+#define SOFT_FIXED_ONE ((i64)(1) << SOFT_FIXED_SHIFT)
+#define SOFT_FIXED_HALF (SOFT_FIXED_ONE / 2)
+
+#define SOFT_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define SOFT_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define SOFT_CLAMP(v, lo, hi) SOFT_MIN(SOFT_MAX(v, lo), hi)
 
 // Keyword definitions
 #define internal static
@@ -123,11 +191,156 @@
 #pragma region SOFT_INTERNAL
 // ------------------------------------------------------
 
+// Blending: per-pixel operator and span kernels (one of each for every SoftBlendMode)
+typedef Pixel (*SoftBlendOp)(Pixel dst, Pixel src);
+typedef void (*SoftFillKernel)(Pixel* dst, i32 count, Pixel pixel);
+typedef void (*SoftCopyKernel)(Pixel* dst, const Pixel* src, i32 count);
+
+// Clipping: half-open pixel bounds [x0, x1) x [y0, y1)
+typedef struct { i32 x0; i32 y0; i32 x1; i32 y1; } SoftBounds;
+
+// Frame arena: chain of bump-allocated blocks (the data follows the aligned header), and a position in it
+typedef struct SoftArenaBlock { struct SoftArenaBlock* next; size_t size; size_t used; } SoftArenaBlock;
+typedef struct { SoftArenaBlock* block; size_t used; } SoftArenaMark;
+
+#define SOFT_ARENA_HEADER_SIZE SOFT_ARENA_ALIGN(sizeof(SoftArenaBlock))
+
+// Asset packs: the header, followed by the entry table and the 64-byte aligned pixel data of every image
+typedef struct { u32 magic; u32 version; u32 image_count; u32 reserved[13]; } SoftPackHeader;
+typedef struct { char name[SOFT_PACK_NAME_SIZE]; u64 offset; i32 width; i32 height; i32 channels; u32 reserved; } SoftPackEntry;
+
+_Static_assert(sizeof(SoftPackHeader) == 64 && sizeof(SoftPackEntry) == 128, "Pack layout must not depend on the compiler");
+
+// Resources: a cached image, shared by every handle to its path
+typedef struct {
+    char* path;
+    u32 hash;
+    Image image;        // The data is NULL while the image is evicted (the size is kept)
+    ImageJob* job;      // Pending reload
+    bool pinned;        // Never evicted
+    u64 last_used;      // Use stamp (see: softGetImageResource), orders the eviction
+    u64 last_frame;     // Frame of the last use + 1: images used during the current frame are never evicted
+    i32 references;     // Zero for free slots
+    u32 generation;     // Bumped when the slot is freed, so stale handles don't resolve
+    i32 next_free;      // Free list link: slot index + 1, 0 ends the list
+} SoftResource;
+
+// Image runs: every row of an encoded image is a list of (type << SOFT_RUN_SHIFT | length) entries
+typedef enum { SOFT_RUN_SKIP = 0, SOFT_RUN_OPAQUE, SOFT_RUN_BLEND } SoftRunType;
+
+// Atlas packing: a skyline segment (the packed area below it is full), and the skyline of a page
+typedef struct { i32 x; i32 y; i32 width; } SoftSkylineNode;
+typedef struct { SoftSkylineNode* nodes; i32 count; i32 height; } SoftSkyline;
+
+// Deferred drawing: a queued primitive, with the state it was submitted with and the screen area it may touch
+typedef enum { SOFT_COMMAND_CLEAR = 0, SOFT_COMMAND_RECTANGLE, SOFT_COMMAND_IMAGE, SOFT_COMMAND_IMAGE_PRO, SOFT_COMMAND_IMAGE_REC, SOFT_COMMAND_TEXT } SoftCommandType;
+
+typedef struct {
+    SoftCommandType type;
+    SoftBlendMode blend_mode;
+    SoftImageFilter image_filter;
+    bool camera_active;
+    Camera2D camera;
+
+    SoftBounds bounds;      // Screen space, within the clip area
+    bool opaque;            // Every pixel of [bounds] is replaced
+
+    Pixel pixel;            // Color or tint
+    union {
+        Rect rect;
+        struct { Image image; Rect source; Rect dest; iVec2 pivot; SoftImageFlip flip; } image;
+        struct { Font* font; const char* text; iVec2 position; } text;
+    };
+} SoftDrawCommand;
+
+// Tilemaps: a grid of atlas region indices (negative: empty cell), drawn tile by tile or from its pre-rendered chunks
+typedef struct {
+    Image image;        // The chunk's tiles, rendered when the chunk is first drawn
+    i32 tile_count;     // Non-empty cells; empty chunks are never drawn
+    bool full;          // Every pixel of the chunk is covered by a tile
+    bool dirty;         // A tile changed since [image] was rendered
+} SoftTileChunk;
+
+struct Tilemap {
+    Atlas* atlas;
+    i32* tiles;
+    iVec2 size;             // In tiles
+    iVec2 tile_size;        // In pixels
+    SoftTileChunk* chunks;  // NULL for maps drawn tile by tile
+    iVec2 chunk_tiles;      // Tiles per chunk
+    iVec2 chunk_count;
+};
+
+// Draw recording: the file header, the calls (each one is its type, then its arguments), and the drawing state they depend on
+typedef struct { u32 magic; u32 version; i32 width; i32 height; } SoftRecordingHeader;
+
+typedef enum {
+    SOFT_CALL_FRAME = 0, SOFT_CALL_STATE,
+    SOFT_CALL_CLEAR, SOFT_CALL_CLEAR_COLOR, SOFT_CALL_SCROLL,
+    SOFT_CALL_RECTANGLE, SOFT_CALL_RECTANGLE_LINES, SOFT_CALL_RECTANGLE_EX, SOFT_CALL_RECTANGLE_ROTATED,
+    SOFT_CALL_LINE, SOFT_CALL_LINE_AA, SOFT_CALL_LINE_STRIP, SOFT_CALL_LINE_BEZIER, SOFT_CALL_LINE_BEZIER_CUBIC,
+    SOFT_CALL_CIRCLE, SOFT_CALL_CIRCLE_LINES, SOFT_CALL_CIRCLE_AA, SOFT_CALL_CIRCLE_LINES_AA,
+    SOFT_CALL_TRIANGLE, SOFT_CALL_TRIANGLE_LINES, SOFT_CALL_TRIANGLE_COLORS, SOFT_CALL_TRIANGLE_TEXTURED,
+    SOFT_CALL_POLYGON,
+    SOFT_CALL_LINE_STROKE, SOFT_CALL_LINE_STRIP_STROKE, SOFT_CALL_LINE_BEZIER_STROKE, SOFT_CALL_LINE_BEZIER_CUBIC_STROKE,
+    SOFT_CALL_POLYGON_STROKE, SOFT_CALL_RECTANGLE_STROKE, SOFT_CALL_CIRCLE_STROKE,
+    SOFT_CALL_TEXT,
+    SOFT_CALL_IMAGE, SOFT_CALL_IMAGE_ROTATED, SOFT_CALL_IMAGE_PRO, SOFT_CALL_IMAGE_REC,
+    SOFT_CALL_COUNT
+} SoftCallType;
+
+typedef struct {
+    i32 blend_mode;
+    i32 image_filter;
+    i32 fill_rule;
+    i32 line_join;
+    i32 line_cap;
+    i32 image_runs;
+    i32 camera_active;
+    i32 deferred;
+    SoftBounds clip;
+    Camera2D camera;
+} SoftRecordState;
+
+_Static_assert(sizeof(SoftRecordState) == 72, "Recording layout must not depend on the compiler");
+
+// Images referenced by the recording so far, keyed by their pixels: the copy detects new content under the same pointer
+typedef struct { const Pixel* data; iVec2 size; Pixel* copy; u32 id; u64 frame; } SoftRecordedImage;
+typedef struct { const Font* font; const u8* atlas; u32 id; } SoftRecordedFont;
+
+// Replay: the recording read into memory, and the images and fonts it defined so far
+typedef struct {
+    u8* data;
+    size_t size;
+    size_t offset;
+    bool failed;
+
+    Image* images;
+    i32 image_count;
+    Font** fonts;
+    i32 font_count;
+} SoftReplay;
+
+// Asynchronous image loading: a queued decode, owned by the caller until softWaitImage
+struct ImageJob {
+    const char* path;
+    Image image;
+    bool runs;              // CORE.Config.image_runs when queued; the worker doesn't read the config
+    SDL_atomic_t done;      // Set by the worker once [image] is written
+    SDL_sem* finished;
+    ImageJob* next;
+};
+
 // CORE: Global state struct
 struct {
     // CORE.Config - applications config
     struct {
-        bool alpha_blend;
+        SoftBlendMode blend_mode;
+        SoftImageFilter image_filter;
+        SoftFillRule fill_rule;
+        SoftLineJoin line_join;
+        SoftLineCap line_cap;
+        bool image_runs;
     } Config;
 
     struct {
@@ -169,6 +382,27 @@ struct {
         iVec2 size;
     } PixelBuffer;
 
+    // CORE.Clip: Clip rectangle stack (every entry is already intersected with the one below it)
+    struct {
+        SoftBounds stack[SOFT_CLIP_STACK_SIZE_MAX];
+        i32 count;
+    } Clip;
+
+    // CORE.Camera: Active 2D camera (between softBeginMode2D and softEndMode2D)
+    struct {
+        Camera2D camera;
+        d32 cos;
+        d32 sin;
+
+        bool active;
+        bool unrotated;
+        bool translation_only;
+        iVec2 translation;
+
+        SoftBounds view;        // World-space bounding box of the clip area
+        bool view_valid;
+    } Camera;
+
     // CORE.Input: Input state
     struct {
         // CORE.Input.Mouse: Mouse state
@@ -206,1179 +440,7633 @@ struct {
         f32 application_lifetime;
         
         u32 framerate;
+        u64 frame_count;
+
+        // Rolling window of the last frame times, in seconds (see: softGetFrameTimePercentiles)
+        f32 frame_times[SOFT_FRAME_TIME_WINDOW];
+        i32 frame_time_count;
+        i32 frame_time_next;
+        u64 frame_end;          // Performance counter at the end of the last frame
     } Time;
 
+    // CORE.Text: Default font, baked at every scale it's used with (see: softGetDefaultFont)
+    struct {
+        Font default_fonts[SOFT_FONT_DEFAULT_SCALE_MAX];
+    } Text;
+
+    // CORE.Arena: Per-frame temporaries (see: softFrameAlloc), reset by softBlit
+    struct {
+        SoftArenaBlock* first;
+        SoftArenaBlock* current;
+    } Arena;
+
+    // CORE.Loader: Image decoding worker pool (started by the first softLoadImageAsync)
+    struct {
+        SDL_Thread* workers[SOFT_LOADER_WORKERS_MAX];
+        i32 worker_count;
+
+        SDL_mutex* lock;    // Guards the queue
+        SDL_sem* pending;   // Counts the queued jobs
+        ImageJob* head;
+        ImageJob* tail;
+    } Loader;
+
+    // CORE.Deferred: Draw queue of the deferred mode (see: softBeginDeferred)
+    struct {
+        SoftDrawCommand* commands;
+        i32 count;
+        i32 capacity;
+
+        bool active;
+        bool replaying;     // Set while the queue is drawn, so the primitives draw instead of queueing
+    } Deferred;
+
+    // CORE.Debug: Write counters of the debug views (see: softSetDebugView), reset by softBlit
+    struct {
+        SoftDebugView view;
+
+        u16* writes;        // Per pixel of the buffer: every write, and the ones that blended with the destination
+        u16* blends;
+        Pixel* overlay;     // The frame presented instead of the buffer
+        i32 capacity;       // Pixels
+
+        u64 total_writes;
+        u64 total_blends;
+        f32 overdraw;       // Of the last presented frame
+        f32 blend_ratio;
+    } Debug;
+
+    // CORE.Recording: Draw call stream being written (see: softBeginRecording)
+    struct {
+        FILE* file;
+        bool failed;                // A write failed, the recording is incomplete
+        i32 depth;                  // Nesting of the recorded calls: only the outermost one is written
+        u64 frame;
+
+        SoftRecordState state;      // Last written state
+        bool state_valid;
+
+        // Open-addressing table of the images, keyed by their pixels
+        SoftRecordedImage* images;
+        i32 image_capacity;
+        i32 image_used;
+        u32 image_ids;
+
+        SoftRecordedFont* fonts;
+        i32 font_count;
+    } Recording;
+
+    // CORE.Packs: Mapped asset packs (their images are owned by the mapping, see: softUnloadImage)
+    struct {
+        Pack packs[SOFT_PACK_COUNT_MAX];
+        i32 count;
+    } Packs;
+
     // CORE.Resources: Resources
     struct {
+        // Caller-owned images, unloaded with the rest (see: softRegisterImage)
         Image** image_ptrs;
         u32 image_ptrs_count;
+        u32 image_ptrs_capacity;
+
+        // Cached images (see: softLoadImageResource): the slots, and an open-addressing table of slot indices keyed by path
+        SoftResource* slots;
+        i32 slot_count;
+        i32 slot_capacity;
+        i32 free_slot;          // Head of the free list: slot index + 1, 0 when empty
+
+        i32* table;
+        i32 table_capacity;
+        i32 table_used;         // Including the deleted entries
+
+        // Memory budget of the cached images, in bytes (0: unlimited)
+        u64 budget;
+        u64 memory_used;
+        u64 use_clock;
     } Resources;
 } CORE;
 
-internal void softSetPixel(i32 x, i32 y, Pixel pixel) {
-    // Check if the pixel buffer exists.
-    if(!CORE.PixelBuffer.pixel_buffer) {
-        softLogError("Pixel data not valid. Returning...");
+// ------------------------------
+// Frame arena.
+// Temporaries live until the end of the frame: softFrameAlloc only bumps an offset, and softBlit rewinds it.
+// When a block runs out, the next one is chained after it (blocks never move, so the pointers stay valid);
+// at the reset, the chain is merged into a single block big enough for the whole frame.
+// The library's own scratch memory is released as soon as the call is done (softFrameMark / softFrameRelease).
+// ------------------------------
+
+internal SoftArenaBlock* softArenaCreateBlock(size_t size, SoftArenaBlock* next) {
+    SoftArenaBlock* block = (SoftArenaBlock*)malloc(SOFT_ARENA_HEADER_SIZE + size);
+
+    if(!block) {
+        softLogError("softFrameAlloc: %s", strerror(errno));
+        return NULL;
+    }
+
+    block->next = next;
+    block->size = size;
+    block->used = 0;
+
+    return block;
+}
+
+internal inline u8* softArenaData(SoftArenaBlock* block) {
+    return (u8*)(block) + SOFT_ARENA_HEADER_SIZE;
+}
+
+internal inline SoftArenaMark softFrameMark(void) {
+    return (SoftArenaMark) { CORE.Arena.current, CORE.Arena.current ? CORE.Arena.current->used : 0 };
+}
+
+internal void softFrameRelease(SoftArenaMark mark) {
+    // Frees everything allocated after [mark]; the blocks chained since then are kept for reuse.
+    if(!mark.block) {
+        mark = (SoftArenaMark) { CORE.Arena.first, 0 };
+    }
+
+    CORE.Arena.current = mark.block;
+
+    if(mark.block) {
+        mark.block->used = mark.used;
+    }
+}
+
+internal void* softFrameGrow(void* memory, size_t size, size_t new_size) {
+    // Resizes an arena allocation: the most recent one grows in place when its block has room.
+    SoftArenaBlock* block = CORE.Arena.current;
+
+    if(memory && block && (u8*)(memory) + SOFT_ARENA_ALIGN(size) == softArenaData(block) + block->used) {
+        size_t end = (u8*)(memory) - softArenaData(block) + SOFT_ARENA_ALIGN(new_size);
+
+        if(end <= block->size) {
+            block->used = end;
+            return memory;
+        }
+    }
+
+    void* result = softFrameAlloc(new_size);
+
+    if(result && memory) {
+        memcpy(result, memory, SOFT_MIN(size, new_size));
+    }
+
+    return result;
+}
+
+internal void softFrameReset(void) {
+    SoftArenaBlock* first = CORE.Arena.first;
+
+    if(first && first->next) {
+        size_t total = 0;
+
+        for(SoftArenaBlock* block = first; block;) {
+            SoftArenaBlock* next = block->next;
+            total += block->size;
+            free(block);
+            block = next;
+        }
+
+        first = CORE.Arena.first = softArenaCreateBlock(total, NULL);
+    }
+
+    if(first) {
+        first->used = 0;
+    }
+
+    CORE.Arena.current = first;
+}
+
+internal void softFrameFree(void) {
+    for(SoftArenaBlock* block = CORE.Arena.first; block;) {
+        SoftArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    CORE.Arena.first = NULL;
+    CORE.Arena.current = NULL;
+}
+
+// ------------------------------
+// Debug views.
+// While a view is on, the span kernels and the few direct writes count every pixel they store (see: softCountWrites);
+// softBlit then presents the counters as a heatmap over the frame, and clears them for the next one.
+// ------------------------------
+
+internal void softCountWrites(const Pixel* dst, i32 count, bool blended) {
+    // Writes outside of the current buffer (into images) aren't counted.
+    ptrdiff_t offset = dst - CORE.PixelBuffer.pixel_buffer;
+    ptrdiff_t limit = SOFT_MIN(CORE.Debug.capacity, CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y);
+
+    if(offset < 0 || offset >= limit || count <= 0) {
         return;
     }
 
-    // Simple boundary check.
-    if(x < 0 || x >= CORE.PixelBuffer.size.x || y < 0 || y >= CORE.PixelBuffer.size.y) { 
-        return; 
+    count = (i32)SOFT_MIN(count, limit - offset);
+
+    u16* writes = &CORE.Debug.writes[offset];
+    for(i32 i = 0; i < count; i++) {
+        writes[i] += writes[i] != UINT16_MAX;
     }
 
-    // Check if the pixel at position [x, y] equals the color given as a parameter.
-    // If so, skip the rest of this function; repeating the same action for something that doesn't change is a resource-waste. 
-    if(softPixelCompare(pixel, softGetPixelColor(x, y))) { 
-        return; 
+    CORE.Debug.total_writes += count;
+
+    if(blended) {
+        u16* blends = &CORE.Debug.blends[offset];
+        for(i32 i = 0; i < count; i++) {
+            blends[i] += blends[i] != UINT16_MAX;
+        }
+
+        CORE.Debug.total_blends += count;
     }
+}
 
-    if(CORE.Config.alpha_blend && !softPixelCompare(pixel, BLANK)) {
-        pixel = softMixPixels(
-            softGetPixelColor(x, y),
-            pixel, 
-            softPixelToColor(pixel).a
-        );
+internal void softResetDebugCounters(void) {
+    // Sizes the counters to the current buffer and zeroes them.
+    i32 capacity = CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y;
+
+    if(capacity != CORE.Debug.capacity) {
+        free(CORE.Debug.writes);
+        free(CORE.Debug.blends);
+        free(CORE.Debug.overlay);
+
+        CORE.Debug.writes = (u16*)malloc(capacity * sizeof(u16));
+        CORE.Debug.blends = (u16*)malloc(capacity * sizeof(u16));
+        CORE.Debug.overlay = (Pixel*)malloc(capacity * sizeof(Pixel));
+        CORE.Debug.capacity = capacity;
+
+        if(!CORE.Debug.writes || !CORE.Debug.blends || !CORE.Debug.overlay) {
+            softLogError("softSetDebugView: Failed to allocate the write counters. Returning...");
+
+            free(CORE.Debug.writes);
+            free(CORE.Debug.blends);
+            free(CORE.Debug.overlay);
+            memset(&CORE.Debug, 0, sizeof(CORE.Debug));
+            return;
+        }
+    }
+
+    memset(CORE.Debug.writes, 0, capacity * sizeof(u16));
+    memset(CORE.Debug.blends, 0, capacity * sizeof(u16));
+    CORE.Debug.total_writes = 0;
+    CORE.Debug.total_blends = 0;
+}
+
+internal Pixel* softRenderDebugView(void) {
+    // Writes the heatmap of the counters into the overlay, shaded by the brightness of the frame so its shapes stay readable.
+    // Overdraw: blue (1 write), green, yellow, orange, red, pink, magenta, white (8 or more). Blending: green (none blended) to red (all).
+    global const Pixel overdraw_colors[8] = { 0xFFC04000, 0xFF40C000, 0xFF00E0E0, 0xFF0080FF, 0xFF0000FF, 0xFF8000FF, 0xFFFF00FF, 0xFFFFFFFF };
+
+    i32 count = CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y;
+
+    if(!CORE.Debug.overlay || count != CORE.Debug.capacity) {
+        return NULL;
     }
 
-    if(softPixelCompare(pixel, BLANK)) {
-        pixel = softGetPixelColor(x, y);
+    const Pixel* frame = CORE.PixelBuffer.pixel_buffer;
+
+    for(i32 i = 0; i < count; i++) {
+        Pixel pixel = frame[i];
+        u32 luma = ((pixel & 0xFF) * 77 + ((pixel >> 8) & 0xFF) * 150 + ((pixel >> 16) & 0xFF) * 29) >> 8;
+        u32 writes = CORE.Debug.writes[i];
+
+        if(writes == 0) {
+            CORE.Debug.overlay[i] = 0xFF000000 | (luma >> 2) * 0x010101;
+            continue;
+        }
+
+        Pixel heat;
+
+        if(CORE.Debug.view == DEBUG_VIEW_OVERDRAW) {
+            heat = overdraw_colors[SOFT_MIN(writes, 8) - 1];
+        } else {
+            u32 red = CORE.Debug.blends[i] * 255 / writes;
+            heat = 0xFF000000 | ((255 - red) << 8) | red;
+        }
+
+        u32 shade = 128 + (luma >> 1);
+        CORE.Debug.overlay[i] = 0xFF000000 |
+            ((((heat >> 16) & 0xFF) * shade >> 8) << 16) |
+            ((((heat >> 8) & 0xFF) * shade >> 8) << 8) |
+            ((heat & 0xFF) * shade >> 8);
     }
 
-    CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x] = pixel;
+    return CORE.Debug.overlay;
 }
 
-internal softKeyCode keycode_to_scancode[] = {
-    KEY_NULL,
+// ------------------------------
+// Blending operators.
+// All of them work on the 0xAABBGGRR pixel layout and use 8.8 fixed-point weights:
+// the source alpha is remapped from [0, 255] to [0, 256] so that the division by 255 becomes a shift.
+// Every operator has a scalar version (softBlendPixel*) and, with SSE2, a 4-pixel version (softBlendSimd*).
+// Both versions use the exact same formula, so the result doesn't depend on where the span got split.
+// ------------------------------
+
+internal inline u32 softAlphaWeight(Pixel pixel) {
+    u32 a = pixel >> 24;
     
-    0,
-    0,
-    0,
+    return a + (a >> 7);
+}
 
-    KEY_A,
-    KEY_B,
-    KEY_C,
-    KEY_D,
-    KEY_E,
-    KEY_F,
-    KEY_G,
-    KEY_H,
-    KEY_I,
-    KEY_J,
-    KEY_K,
-    KEY_L,
-    KEY_M,
-    KEY_N,
-    KEY_O,
-    KEY_P,
-    KEY_Q,
-    KEY_R,
-    KEY_S,
-    KEY_T,
-    KEY_U,
-    KEY_V,
-    KEY_W,
-    KEY_X,
-    KEY_Y,
-    KEY_Z,
+internal inline u32 softSaturateLanes(u32 lanes) {
+    // Each 16-bit lane holds a 9-bit sum; a carry into the 9th bit saturates the lane to 0xFF.
+    u32 carry = lanes & 0x01000100;
 
-    KEY_ONE, 
-    KEY_TWO, 
-    KEY_THREE, 
-    KEY_FOUR, 
-    KEY_FIVE, 
-    KEY_SIX, 
-    KEY_SEVEN, 
-    KEY_EIGHT, 
-    KEY_NINE, 
-    KEY_ZERO, 
+    return (lanes | (carry - (carry >> 8))) & 0x00FF00FF;
+}
 
-    0, // SDL_SCANCODE_RETURN
+internal inline Pixel softBlendPixelReplace(Pixel dst, Pixel src) {
+    (void)dst;
 
-    KEY_ESCAPE,
-    KEY_BACKSPACE,
-    KEY_TAB,
-    KEY_SPACE,
+    return src;
+}
 
-    KEY_MINUS,
-    KEY_EQUALS,
-    KEY_LSQB,
-    KEY_RSQB,
-    KEY_BSLASH,
+internal inline Pixel softBlendPixelAlpha(Pixel dst, Pixel src) {
+    u32 a = softAlphaWeight(src);
 
-    0, // SDL_SCANCODE_NONUSHASH
+    // Destination alpha is blended against an opaque source, which gives the regular "over" alpha: a + dst.a * (1 - a).
+    u32 rb = (((src & 0x00FF00FF) * a + (dst & 0x00FF00FF) * (256 - a)) >> 8) & 0x00FF00FF;
+    u32 ag = ((((src | 0xFF000000) >> 8) & 0x00FF00FF) * a + ((dst >> 8) & 0x00FF00FF) * (256 - a)) & 0xFF00FF00;
 
-    KEY_SEMI,
-    KEY_APOS,
-    KEY_GRAVE,
-    KEY_COMMA,
-    KEY_PERIOD,
-    KEY_SLASH,
-    KEY_CAPS,
-    KEY_F1, 
-    KEY_F2, 
-    KEY_F3, 
-    KEY_F4, 
-    KEY_F5, 
-    KEY_F6, 
-    KEY_F7, 
-    KEY_F8, 
-    KEY_F9, 
-    KEY_F10, 
-    KEY_F11, 
-    KEY_F12, 
+    return rb | ag;
+}
 
-    0, // SDL_SCANCODE_PRINTSCREEN
-    0, // SDL_SCANCODE_SCROLLLOCK
-    0, // SDL_SCANCODE_PAUSE
-    0, // SDL_SCANCODE_INSERT
-    0, // SDL_SCANCODE_HOME
-    0, // SDL_SCANCODE_PAGEUP
+internal inline Pixel softBlendPixelAlphaPremultiplied(Pixel dst, Pixel src) {
+    u32 ia = 256 - softAlphaWeight(src);
 
-    KEY_DEL,
+    u32 rb = softSaturateLanes((src & 0x00FF00FF) + ((((dst & 0x00FF00FF) * ia) >> 8) & 0x00FF00FF));
+    u32 ag = softSaturateLanes(((src >> 8) & 0x00FF00FF) + (((((dst >> 8) & 0x00FF00FF) * ia) >> 8) & 0x00FF00FF));
 
-    0, // SDL_SCANCODE_END
-    0, // SDL_SCANCODE_PAGEDOWN
+    return rb | (ag << 8);
+}
 
-    KEY_RIGHT, 
-    KEY_LEFT, 
-    KEY_DOWN, 
-    KEY_UP, 
+internal inline Pixel softBlendPixelAdditive(Pixel dst, Pixel src) {
+    u32 a = softAlphaWeight(src);
 
-    0, // SDL_SCANCODE_KP_DIVIDE
-    0, // SDL_SCANCODE_KP_MULTIPLY
-    0, // SDL_SCANCODE_KP_MINUS
-    0, // SDL_SCANCODE_KP_PLUS
-    0, // SDL_SCANCODE_KP_ENTER
-    0, // SDL_SCANCODE_KP_1
-    0, // SDL_SCANCODE_KP_2
-    0, // SDL_SCANCODE_KP_3
-    0, // SDL_SCANCODE_KP_4
-    0, // SDL_SCANCODE_KP_5
-    0, // SDL_SCANCODE_KP_6
-    0, // SDL_SCANCODE_KP_7
-    0, // SDL_SCANCODE_KP_8
-    0, // SDL_SCANCODE_KP_9
-    0, // SDL_SCANCODE_KP_0
-    0, // SDL_SCANCODE_KP_PERIOD
-    0, // SDL_SCANCODE_NONUSBACKSLASH 
-    0, // SDL_SCANCODE_POWER 
-    0, // SDL_SCANCODE_KP_EQUALS 
-    0, // SDL_SCANCODE_F13 
-    0, // SDL_SCANCODE_F14 
-    0, // SDL_SCANCODE_F15 
-    0, // SDL_SCANCODE_F16 
-    0, // SDL_SCANCODE_F17 
-    0, // SDL_SCANCODE_F18 
-    0, // SDL_SCANCODE_F19 
-    0, // SDL_SCANCODE_F20 
-    0, // SDL_SCANCODE_F21 
-    0, // SDL_SCANCODE_F22 
-    0, // SDL_SCANCODE_F23 
-    0, // SDL_SCANCODE_F24 
-    0, // SDL_SCANCODE_EXECUTE 
-    0, // SDL_SCANCODE_HELP 
-    0, // SDL_SCANCODE_MENU 
-    0, // SDL_SCANCODE_SELECT 
-    0, // SDL_SCANCODE_STOP 
-    0, // SDL_SCANCODE_AGAIN 
-    0, // SDL_SCANCODE_UNDO 
-    0, // SDL_SCANCODE_CUT 
-    0, // SDL_SCANCODE_COPY 
-    0, // SDL_SCANCODE_PASTE 
-    0, // SDL_SCANCODE_FIND 
-    0, // SDL_SCANCODE_MUTE 
-    0, // SDL_SCANCODE_VOLUMEUP 
-    0, // SDL_SCANCODE_VOLUMEDOWN 
-    0, // SDL_SCANCODE_KP_COMMA 
-    0, // SDL_SCANCODE_KP_EQUALSAS400 
-    0, // SDL_SCANCODE_INTERNATIONAL1 
-    0, // SDL_SCANCODE_INTERNATIONAL2 
-    0, // SDL_SCANCODE_INTERNATIONAL3 
-    0, // SDL_SCANCODE_INTERNATIONAL4 
-    0, // SDL_SCANCODE_INTERNATIONAL5 
-    0, // SDL_SCANCODE_INTERNATIONAL6 
-    0, // SDL_SCANCODE_INTERNATIONAL7 
-    0, // SDL_SCANCODE_INTERNATIONAL8 
-    0, // SDL_SCANCODE_INTERNATIONAL9 
-    0, // SDL_SCANCODE_LANG1 
-    0, // SDL_SCANCODE_LANG2 
-    0, // SDL_SCANCODE_LANG3 
-    0, // SDL_SCANCODE_LANG4 
-    0, // SDL_SCANCODE_LANG5 
-    0, // SDL_SCANCODE_LANG6 
-    0, // SDL_SCANCODE_LANG7 
-    0, // SDL_SCANCODE_LANG8 
-    0, // SDL_SCANCODE_LANG9 
-    0, // SDL_SCANCODE_ALTERASE 
-    0, // SDL_SCANCODE_SYSREQ 
-    0, // SDL_SCANCODE_CANCEL 
-    0, // SDL_SCANCODE_CLEAR 
-    0, // SDL_SCANCODE_PRIOR 
-    0, // SDL_SCANCODE_RETURN2 
-    0, // SDL_SCANCODE_SEPARATOR 
-    0, // SDL_SCANCODE_OUT 
-    0, // SDL_SCANCODE_OPER 
-    0, // SDL_SCANCODE_CLEARAGAIN 
-    0, // SDL_SCANCODE_CRSEL 
-    0, // SDL_SCANCODE_EXSEL 
-    0, // SDL_SCANCODE_KP_00 
-    0, // SDL_SCANCODE_KP_000 
-    0, // SDL_SCANCODE_THOUSANDSSEPARATOR 
-    0, // SDL_SCANCODE_DECIMALSEPARATOR 
-    0, // SDL_SCANCODE_CURRENCYUNIT 
-    0, // SDL_SCANCODE_CURRENCYSUBUNIT 
-    0, // SDL_SCANCODE_KP_LEFTPAREN 
-    0, // SDL_SCANCODE_KP_RIGHTPAREN 
-    0, // SDL_SCANCODE_KP_LEFTBRACE 
-    0, // SDL_SCANCODE_KP_RIGHTBRACE 
-    0, // SDL_SCANCODE_KP_TAB 
-    0, // SDL_SCANCODE_KP_BACKSPACE 
-    0, // SDL_SCANCODE_KP_A 
-    0, // SDL_SCANCODE_KP_B 
-    0, // SDL_SCANCODE_KP_C 
-    0, // SDL_SCANCODE_KP_D 
-    0, // SDL_SCANCODE_KP_E 
-    0, // SDL_SCANCODE_KP_F 
-    0, // SDL_SCANCODE_KP_XOR 
-    0, // SDL_SCANCODE_KP_POWER 
-    0, // SDL_SCANCODE_KP_PERCENT 
-    0, // SDL_SCANCODE_KP_LESS 
-    0, // SDL_SCANCODE_KP_GREATER 
-    0, // SDL_SCANCODE_KP_AMPERSAND 
-    0, // SDL_SCANCODE_KP_DBLAMPERSAND 
-    0, // SDL_SCANCODE_KP_VERTICALBAR 
-    0, // SDL_SCANCODE_KP_DBLVERTICALBAR 
-    0, // SDL_SCANCODE_KP_COLON 
-    0, // SDL_SCANCODE_KP_HASH 
-    0, // SDL_SCANCODE_KP_SPACE 
-    0, // SDL_SCANCODE_KP_AT 
-    0, // SDL_SCANCODE_KP_EXCLAM 
-    0, // SDL_SCANCODE_KP_MEMSTORE 
-    0, // SDL_SCANCODE_KP_MEMRECALL 
-    0, // SDL_SCANCODE_KP_MEMCLEAR 
-    0, // SDL_SCANCODE_KP_MEMADD 
-    0, // SDL_SCANCODE_KP_MEMSUBTRACT 
-    0, // SDL_SCANCODE_KP_MEMMULTIPLY 
-    0, // SDL_SCANCODE_KP_MEMDIVIDE 
-    0, // SDL_SCANCODE_KP_PLUSMINUS 
-    0, // SDL_SCANCODE_KP_CLEAR 
-    0, // SDL_SCANCODE_KP_CLEARENTRY 
-    0, // SDL_SCANCODE_KP_BINARY 
-    0, // SDL_SCANCODE_KP_OCTAL 
-    0, // SDL_SCANCODE_KP_DECIMAL 
-    0, // SDL_SCANCODE_KP_HEXADECIMAL 
+    u32 rb = softSaturateLanes((dst & 0x00FF00FF) + ((((src & 0x00FF00FF) * a) >> 8) & 0x00FF00FF));
+    u32 ag = softSaturateLanes(((dst >> 8) & 0x00FF00FF) + (((((src >> 8) & 0x00FF00FF) * a) >> 8) & 0x00FF00FF));
 
-    KEY_LCTRL, 
-    KEY_LSHIFT, 
-    KEY_LALT, 
+    return rb | (ag << 8);
+}
 
-    0, // SDL_SCANCODE_LGUI 
+internal inline Pixel softBlendPixelMultiply(Pixel dst, Pixel src) {
+    u32 a = softAlphaWeight(src);
+    Pixel result = dst & 0xFF000000;
 
-    KEY_RCTRL,
-    KEY_RSHIFT,
-    KEY_RALT,
-    
-    0, // SDL_SCANCODE_RGUI
-    0, // SDL_SCANCODE_MODE
-};
+    for(i32 shift = 0; shift < 24; shift += 8) {
+        u32 d = (dst >> shift) & 0xFF;
+        u32 s = (src >> shift) & 0xFF;
+        u32 m = (d * (s + (s >> 7))) >> 8;
 
-internal softKeyCode SDLScancodeToSoftKeyCode(SDL_Scancode code) {
-    if(code >= 0 || code < sizeof(keycode_to_scancode) / sizeof(softKeyCode)) {
-        return keycode_to_scancode[code];
+        result |= ((m * a + d * (256 - a)) >> 8) << shift;
     }
 
-    return KEY_NULL;
+    return result;
 }
 
-internal void softTimeMenagement() {
-    CORE.Time.current = softTime();
-    f32 frame_time = CORE.Time.current - CORE.Time.previous;
-    CORE.Time.previous = CORE.Time.current;
-
-    CORE.Time.delta_time = frame_time;
-
-    if(CORE.Time.delta_time < CORE.Time.frame_target) {
-        softWait(CORE.Time.frame_target - CORE.Time.delta_time);
+internal inline Pixel softBlendPixelScreen(Pixel dst, Pixel src) {
+    u32 a = softAlphaWeight(src);
+    Pixel result = dst & 0xFF000000;
 
-        CORE.Time.current = softTime();
-        f32 wait_time = CORE.Time.current - CORE.Time.previous;
-        CORE.Time.previous = CORE.Time.current;
+    for(i32 shift = 0; shift < 24; shift += 8) {
+        u32 d = (dst >> shift) & 0xFF;
+        u32 s = 255 - ((src >> shift) & 0xFF);
+        u32 m = 255 - (((255 - d) * (s + (s >> 7))) >> 8);
 
-        CORE.Time.delta_time += wait_time;
+        result |= ((m * a + d * (256 - a)) >> 8) << shift;
     }
+
+    return result;
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+internal inline Pixel softBlendPixelColorKey(Pixel dst, Pixel src) {
+    // BLANK is the color key: it leaves the destination as it is.
+    return src == BLANK ? dst : src;
+}
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_CONFIG
-// ------------------------------------------------------
+#if defined(__SSE2__)
 
-SAPI void softAlphaBlendState(bool state) {
-    state ?
-        softLogInfo("softAlphaBlendState: Alpha-Blending: ENABLED (\"Alpha\" channle will be used during the color calculations).") :
-        softLogInfo("softAlphaBlendState: Alpha-Blending: DISABLED (\"Alpha\" channle will be immited during the color calculations).");
+// Alpha weights of 4 pixels, broadcasted to the 16-bit channel lanes of the low (pixels 0, 1) and high (pixels 2, 3) halves.
+internal inline void softAlphaWeightSimd(__m128i src, __m128i* a_lo, __m128i* a_hi) {
+    __m128i a = _mm_srli_epi32(src, 24);
+    a = _mm_add_epi32(a, _mm_srli_epi32(a, 7));
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
 
-    CORE.Config.alpha_blend = state;
+    *a_lo = _mm_unpacklo_epi32(a, a);
+    *a_hi = _mm_unpackhi_epi32(a, a);
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
-
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_WINDOW
-// ------------------------------------------------------
+internal inline __m128i softLerpSimd(__m128i d, __m128i s, __m128i a) {
+    const __m128i full = _mm_set1_epi16(256);
 
-SAPI i32 softInit(i32 width, i32 height, const string title) { 
-    softInitPlatform();
-    softInitWindow(width, height, title);
-    softInitRenderer();
-    softInitDefaultPixelBuffer();
+    return _mm_srli_epi16(
+        _mm_add_epi16(
+            _mm_mullo_epi16(s, a), 
+            _mm_mullo_epi16(d, _mm_sub_epi16(full, a))
+        ), 
+        8
+    );
+}
 
-    softLogInfo("softInit: Initialization process overview:");
-    softLogInfo("   > Window state: %s", CORE.Window.valid ? "OK" : "FAIL");
-    softLogInfo("   > Renderer state: %s", CORE.Render.renderer_valid ? "OK" : "FAIL");
-    softLogInfo("   > Render Texture state: %s", CORE.Render.render_texture ? "OK" : "FAIL");
-    softLogInfo("   > Pixel Data state: %s", CORE.PixelBuffer.pixel_buffer ? "OK" : "FAIL");
-    softLogInfo("softInit: Initialization finished. Hello World!");
+internal inline __m128i softBlendSimdReplace(__m128i dst, __m128i src) {
+    (void)dst;
 
-    return SOFT_SUCCESS;
+    return src;
 }
 
-SAPI i32 softInitPlatform(void) {
-    softLogInfo("softInitPlatform: Initializing Soft v.%s", SOFT_VERSION);
-    i32 init = SDL_Init(SDL_INIT_VIDEO);
+internal inline __m128i softBlendSimdAlpha(__m128i dst, __m128i src) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a_lo, a_hi;
+    softAlphaWeightSimd(src, &a_lo, &a_hi);
 
-    if(init != 0) {
-        softLogError("softInitPlatform: %s", SDL_GetError());
-        
-        return SOFT_FAILED;
-    }
+    __m128i s = _mm_or_si128(src, _mm_set1_epi32(0xFF000000));
+    __m128i lo = softLerpSimd(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(s, zero), a_lo);
+    __m128i hi = softLerpSimd(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(s, zero), a_hi);
 
-    strcpy(CORE.Platform.version, softTextFormat("%d.%d.%d", SDL_MAJOR_VERSION, SDL_MINOR_VERSION, SDL_PATCHLEVEL));
-    
-    softAlphaBlendState(true);
+    return _mm_packus_epi16(lo, hi);
+}
 
-    softLogInfo("   > Platform Version: %s", CORE.Platform.version);
-    softLogInfo("   > Version: %s", SOFT_VERSION);
-    softLogInfo("   > Version major: %i", SOFT_VERSION_MAJOR);
-    softLogInfo("   > Version minor: %i", SOFT_VERSION_MINOR);
+internal inline __m128i softBlendSimdAlphaPremultiplied(__m128i dst, __m128i src) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(256);
+    __m128i a_lo, a_hi;
+    softAlphaWeightSimd(src, &a_lo, &a_hi);
 
-    CORE.Platform.valid = true;
+    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(src, zero), _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(full, a_lo)), 8));
+    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(src, zero), _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(full, a_hi)), 8));
 
-    return SOFT_SUCCESS;
+    return _mm_packus_epi16(lo, hi);
 }
 
-SAPI i32 softInitWindow(i32 width, i32 height, const string title) {
-    softLogInfo("softInitWindow: Initializing Window.");
+internal inline __m128i softBlendSimdAdditive(__m128i dst, __m128i src) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a_lo, a_hi;
+    softAlphaWeightSimd(src, &a_lo, &a_hi);
 
-    CORE.Window.screen_size = (iVec2) { width, height };
+    __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src, zero), a_lo), 8);
+    __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src, zero), a_hi), 8);
 
-    SDL_DisplayMode mode;
-    SDL_GetCurrentDisplayMode(0, &mode);
-    CORE.Window.display_size = (iVec2) { mode.w, mode.h };
+    return _mm_adds_epu8(dst, _mm_packus_epi16(lo, hi));
+}
 
-    CORE.Window.quit = false;
+internal inline __m128i softBlendSimdMultiply(__m128i dst, __m128i src) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha_mask = _mm_set1_epi32(0xFF000000);
+    __m128i a_lo, a_hi;
+    softAlphaWeightSimd(src, &a_lo, &a_hi);
 
-    CORE.Input.Mouse.offset = (iVec2) { 0 };
-    CORE.Input.Mouse.scale = (iVec2) { 1, 1 };
+    __m128i d_lo = _mm_unpacklo_epi8(dst, zero);
+    __m128i d_hi = _mm_unpackhi_epi8(dst, zero);
+    __m128i s_lo = _mm_unpacklo_epi8(src, zero);
+    __m128i s_hi = _mm_unpackhi_epi8(src, zero);
 
-    CORE.Input.Keyboard.exit_key = KEY_ESCAPE;
+    __m128i m_lo = _mm_srli_epi16(_mm_mullo_epi16(d_lo, _mm_add_epi16(s_lo, _mm_srli_epi16(s_lo, 7))), 8);
+    __m128i m_hi = _mm_srli_epi16(_mm_mullo_epi16(d_hi, _mm_add_epi16(s_hi, _mm_srli_epi16(s_hi, 7))), 8);
 
-    u32 flags = 0;
-    if(CORE.Window.config_flags & FLAG_WINDOW_RESIZABLE) flags |= SDL_WINDOW_RESIZABLE;
-    if(CORE.Window.config_flags & FLAG_WINDOW_FULLSCREEN) flags |= SDL_WINDOW_FULLSCREEN;
-    if(CORE.Window.config_flags & FLAG_WINDOW_MAXIMIZED) flags |= SDL_WINDOW_MAXIMIZED;
-    if(CORE.Window.config_flags & FLAG_WINDOW_MINIMIZED) flags |= SDL_WINDOW_MINIMIZED;
-    if(CORE.Window.config_flags & FLAG_WINDOW_HIGHDPI) flags |= SDL_WINDOW_ALLOW_HIGHDPI;
+    __m128i result = _mm_packus_epi16(softLerpSimd(d_lo, m_lo, a_lo), softLerpSimd(d_hi, m_hi, a_hi));
 
-    CORE.Window.window = SDL_CreateWindow(
-        title, 
-        SDL_WINDOWPOS_CENTERED, 
-        SDL_WINDOWPOS_CENTERED, 
-        width, 
-        height, 
-        flags
-    );
+    return _mm_or_si128(_mm_andnot_si128(alpha_mask, result), _mm_and_si128(alpha_mask, dst));
+}
 
-    if(!CORE.Window.window) {
-        softLogError("softInitWindow: %s", SDL_GetError());
+internal inline __m128i softBlendSimdScreen(__m128i dst, __m128i src) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha_mask = _mm_set1_epi32(0xFF000000);
+    const __m128i max = _mm_set1_epi16(255);
+    __m128i a_lo, a_hi;
+    softAlphaWeightSimd(src, &a_lo, &a_hi);
 
-        softClosePlatform();
-        
-        return SOFT_FAILED;
-    }
+    __m128i d_lo = _mm_unpacklo_epi8(dst, zero);
+    __m128i d_hi = _mm_unpackhi_epi8(dst, zero);
+    __m128i s_lo = _mm_sub_epi16(max, _mm_unpacklo_epi8(src, zero));
+    __m128i s_hi = _mm_sub_epi16(max, _mm_unpackhi_epi8(src, zero));
 
-    CORE.Window.valid = true;
+    __m128i m_lo = _mm_sub_epi16(max, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(max, d_lo), _mm_add_epi16(s_lo, _mm_srli_epi16(s_lo, 7))), 8));
+    __m128i m_hi = _mm_sub_epi16(max, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(max, d_hi), _mm_add_epi16(s_hi, _mm_srli_epi16(s_hi, 7))), 8));
 
-    softLogInfo("   > Window size: %ix%i", CORE.Window.screen_size.x, CORE.Window.screen_size.y);
-    softLogInfo("   > Display size: %ix%i", CORE.Window.display_size.x, CORE.Window.display_size.y);
+    __m128i result = _mm_packus_epi16(softLerpSimd(d_lo, m_lo, a_lo), softLerpSimd(d_hi, m_hi, a_hi));
 
-    return SOFT_SUCCESS;
+    return _mm_or_si128(_mm_andnot_si128(alpha_mask, result), _mm_and_si128(alpha_mask, dst));
 }
 
-SAPI i32 softInitRenderer(void) {
-    softLogInfo("softInitRenderer: Initializing Renderer.");
+internal inline __m128i softBlendSimdColorKey(__m128i dst, __m128i src) {
+    __m128i key = _mm_cmpeq_epi32(src, _mm_setzero_si128());
 
-    if(!CORE.Window.window) {
-        softLogError("softInitRenderer: Renderer requires a valid Window instance. Returning...");
+    return _mm_or_si128(_mm_and_si128(key, dst), _mm_andnot_si128(key, src));
+}
 
-        softClosePlatform();
+// ------------------------------
+// Span kernels.
+// softFillSpan* - blends a single color over [count] destination pixels.
+// softCopySpan* - blends [count] source pixels over [count] destination pixels.
+// The kernel is picked once per draw call (see: softGetFillKernel, softGetCopyKernel), so the inner loops never branch on the blend mode.
+// [blended]: the kernel reads the destination (only counted by the debug views).
+// ------------------------------
 
-        return SOFT_FAILED;
+#define SOFT_DEFINE_SPAN_KERNELS(name, blended) \
+    internal void softFillSpan##name(Pixel* dst, i32 count, Pixel pixel) { \
+        if(CORE.Debug.view) { \
+            softCountWrites(dst, count, blended); \
+        } \
+        __m128i src4 = _mm_set1_epi32(pixel); \
+        i32 i = 0; \
+        for(; i + 4 <= count; i += 4) { \
+            __m128i dst4 = _mm_loadu_si128((__m128i*)(dst + i)); \
+            _mm_storeu_si128((__m128i*)(dst + i), softBlendSimd##name(dst4, src4)); \
+        } \
+        for(; i < count; i++) { \
+            dst[i] = softBlendPixel##name(dst[i], pixel); \
+        } \
+    } \
+    internal void softCopySpan##name(Pixel* dst, const Pixel* src, i32 count) { \
+        if(CORE.Debug.view) { \
+            softCountWrites(dst, count, blended); \
+        } \
+        i32 i = 0; \
+        for(; i + 4 <= count; i += 4) { \
+            __m128i dst4 = _mm_loadu_si128((__m128i*)(dst + i)); \
+            __m128i src4 = _mm_loadu_si128((const __m128i*)(src + i)); \
+            _mm_storeu_si128((__m128i*)(dst + i), softBlendSimd##name(dst4, src4)); \
+        } \
+        for(; i < count; i++) { \
+            dst[i] = softBlendPixel##name(dst[i], src[i]); \
+        } \
     }
 
-    u32 flags = 0;
-    flags |= SDL_RENDERER_ACCELERATED;
+#else
+
+#define SOFT_DEFINE_SPAN_KERNELS(name, blended) \
+    internal void softFillSpan##name(Pixel* dst, i32 count, Pixel pixel) { \
+        if(CORE.Debug.view) { \
+            softCountWrites(dst, count, blended); \
+        } \
+        for(i32 i = 0; i < count; i++) { \
+            dst[i] = softBlendPixel##name(dst[i], pixel); \
+        } \
+    } \
+    internal void softCopySpan##name(Pixel* dst, const Pixel* src, i32 count) { \
+        if(CORE.Debug.view) { \
+            softCountWrites(dst, count, blended); \
+        } \
+        for(i32 i = 0; i < count; i++) { \
+            dst[i] = softBlendPixel##name(dst[i], src[i]); \
+        } \
+    }
 
-    if(CORE.Window.config_flags & FLAG_WINDOW_VSYNC) {
-        flags |= SDL_RENDERER_PRESENTVSYNC;
-    }        
+#endif
+
+SOFT_DEFINE_SPAN_KERNELS(Replace, false)
+SOFT_DEFINE_SPAN_KERNELS(Alpha, true)
+SOFT_DEFINE_SPAN_KERNELS(AlphaPremultiplied, true)
+SOFT_DEFINE_SPAN_KERNELS(Additive, true)
+SOFT_DEFINE_SPAN_KERNELS(Multiply, true)
+SOFT_DEFINE_SPAN_KERNELS(Screen, true)
+SOFT_DEFINE_SPAN_KERNELS(ColorKey, false)
+
+internal const SoftBlendOp soft_blend_ops[BLEND_COUNT] = {
+    softBlendPixelReplace,
+    softBlendPixelAlpha,
+    softBlendPixelAlphaPremultiplied,
+    softBlendPixelAdditive,
+    softBlendPixelMultiply,
+    softBlendPixelScreen,
+    softBlendPixelColorKey
+};
 
-    CORE.Render.renderer = SDL_CreateRenderer(
-        CORE.Window.window, 
-        -1, 
-        flags
-    );
+internal const SoftFillKernel soft_fill_kernels[BLEND_COUNT] = {
+    softFillSpanReplace,
+    softFillSpanAlpha,
+    softFillSpanAlphaPremultiplied,
+    softFillSpanAdditive,
+    softFillSpanMultiply,
+    softFillSpanScreen,
+    softFillSpanColorKey
+};
 
-    if(!CORE.Render.renderer) {
-        softLogError("softInitRenderer: %s", SDL_GetError());
+internal const SoftCopyKernel soft_copy_kernels[BLEND_COUNT] = {
+    softCopySpanReplace,
+    softCopySpanAlpha,
+    softCopySpanAlphaPremultiplied,
+    softCopySpanAdditive,
+    softCopySpanMultiply,
+    softCopySpanScreen,
+    softCopySpanColorKey
+};
 
-        softCloseWindow();
-        softClosePlatform();
-        
-        return SOFT_FAILED;
+internal inline Pixel softTintPixel(Pixel pixel, Pixel tint) {
+    Pixel result = 0;
+
+    for(i32 shift = 0; shift < 32; shift += 8) {
+        u32 p = (pixel >> shift) & 0xFF;
+        u32 t = (tint >> shift) & 0xFF;
+
+        result |= ((p * (t + (t >> 7))) >> 8) << shift;
     }
 
-    softLogInfo("softInitRenderer: Initializing Render Texture.");
+    return result;
+}
 
-    CORE.Render.render_texture = SDL_CreateTexture(
-        CORE.Render.renderer, 
-        SDL_PIXELFORMAT_ABGR8888, 
-        SDL_TEXTUREACCESS_STREAMING, 
-        CORE.Window.display_size.x, 
-        CORE.Window.display_size.y
-    );
+internal inline Pixel softLerpPixel(Pixel a, Pixel b, u32 t) {
+    // [t] is the 8-bit fraction of the way from [a] to [b].
+    u32 rb = (((a & 0x00FF00FF) * (256 - t) + (b & 0x00FF00FF) * t) >> 8) & 0x00FF00FF;
+    u32 ag = (((a >> 8) & 0x00FF00FF) * (256 - t) + ((b >> 8) & 0x00FF00FF) * t) & 0xFF00FF00;
 
-    if(!CORE.Render.render_texture) {
-        softLogError("softInitRenderer: %s", SDL_GetError());
+    return rb | ag;
+}
 
-        softCloseWindow();
-        softCloseRenderer();
-        softClosePlatform();
-        
-        return SOFT_FAILED;
-    }
+internal void softTintSpan(Pixel* dst, const Pixel* src, i32 count, Pixel tint) {
+    // Modulates [count] pixels by the [tint] color (WHITE leaves them unchanged). [dst] may alias [src].
+    i32 i = 0;
 
-    softLogInfo("   > RenderTexture size: %ix%i", CORE.Window.display_size.x, CORE.Window.display_size.y);
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i t = _mm_unpacklo_epi8(_mm_set1_epi32(tint), zero);
+    t = _mm_add_epi16(t, _mm_srli_epi16(t, 7));
 
-    CORE.Render.size.x = CORE.Window.display_size.x;
-    CORE.Render.size.y = CORE.Window.display_size.y;
+    for(; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), t), 8);
+        __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), t), 8);
 
-    CORE.Render.renderer_valid = true;
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
 
-    return SOFT_SUCCESS;
+    for(; i < count; i++) {
+        dst[i] = softTintPixel(src[i], tint);
+    }
 }
 
-SAPI void softClose(void) {
-    softLogInfo("softClose: Closing Soft v.%s", SOFT_VERSION);
+internal void softLerpSpan(Pixel* dst, const Pixel* a, const Pixel* b, i32 count, u32 t) {
+    // Blends two rows of pixels: dst = a + (b - a) * t / 256.
+    i32 i = 0;
 
-    softUnloadPixelBuffer();
-    softCloseRenderer();
-    softCloseWindow();
-    softClosePlatform();
-}
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i weight = _mm_set1_epi16(t);
 
-SAPI void softClosePlatform(void) {
-    SDL_Quit();
+    for(; i + 4 <= count; i += 4) {
+        __m128i a4 = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i b4 = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i lo = softLerpSimd(_mm_unpacklo_epi8(a4, zero), _mm_unpacklo_epi8(b4, zero), weight);
+        __m128i hi = softLerpSimd(_mm_unpackhi_epi8(a4, zero), _mm_unpackhi_epi8(b4, zero), weight);
 
-    softLogInfo("softClosePlatform: Quitting. Goodbye World...");
-    CORE.Platform.valid = false;
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for(; i < count; i++) {
+        dst[i] = softLerpPixel(a[i], b[i], t);
+    }
 }
 
-SAPI void softCloseWindow(void) {
-    if(!CORE.Window.window) {
-        softLogWarning("softCloseWindow: Window already closed. Returning...");
+internal SoftFillKernel softGetFillKernel(Pixel pixel) {
+    SoftBlendMode mode = CORE.Config.blend_mode;
 
-        return;
+    // With a color key, BLANK draws nothing and any other color is a plain store.
+    if(mode == BLEND_COLOR_KEY) {
+        return pixel == BLANK ? NULL : softFillSpanReplace;
     }
 
-    softLogInfo("softCloseWindow: Closing window.");
+    // A fully transparent color doesn't change anything in these modes, so the whole draw call can be skipped.
+    if(pixel >> 24 == 0 && mode != BLEND_REPLACE && mode != BLEND_ALPHA_PREMULTIPLIED) {
+        return NULL;
+    }
 
-    SDL_DestroyWindow(CORE.Window.window);
-    CORE.Window.valid = false;
+    // An opaque color over alpha blending is just a plain store.
+    if(pixel >> 24 == 0xFF && mode == BLEND_ALPHA) {
+        return softFillSpanReplace;
+    }
+
+    return soft_fill_kernels[mode];
 }
 
-SAPI void softCloseRenderer(void) {
-    if(!CORE.Render.renderer) {
-        softLogWarning("softCloseRenderer: Renderer already closed. Returning...");
+internal SoftCopyKernel softGetCopyKernel(void) {
+    return soft_copy_kernels[CORE.Config.blend_mode];
+}
 
-        return;
+internal SoftBounds softGetClipBounds(void) {
+    // The active clip rectangle, limited to the current pixel buffer.
+    SoftBounds bounds = { 0, 0, CORE.PixelBuffer.size.x, CORE.PixelBuffer.size.y };
+
+    if(CORE.Clip.count > 0) {
+        SoftBounds top = CORE.Clip.stack[CORE.Clip.count - 1];
+
+        bounds.x0 = SOFT_MAX(bounds.x0, top.x0);
+        bounds.y0 = SOFT_MAX(bounds.y0, top.y0);
+        bounds.x1 = SOFT_MIN(bounds.x1, top.x1);
+        bounds.y1 = SOFT_MIN(bounds.y1, top.y1);
     }
 
-    softLogInfo("softCloseRenderer: Unloading renderer.");
+    return bounds;
+}
 
-    SDL_DestroyRenderer(CORE.Render.renderer);
-    CORE.Render.renderer_valid = false;
+internal bool softClipBoundsEmpty(SoftBounds bounds) {
+    return bounds.x0 >= bounds.x1 || bounds.y0 >= bounds.y1;
+}
 
-    if(!CORE.Render.render_texture) {
-        softLogWarning("softCloseRenderer: Render Texture already unloaded. Returning...");
+internal bool softClipRejects(SoftBounds clip, i32 x0, i32 y0, i32 x1, i32 y1) {
+    // Trivial rejection of a primitive, based on its (half-open) bounding box.
+    return x1 <= clip.x0 || x0 >= clip.x1 || y1 <= clip.y0 || y0 >= clip.y1;
+}
 
+internal void softSetPixel(SoftBounds clip, i32 x, i32 y, Pixel pixel) {
+    // [clip]: the active clip bounds (see: softGetClipBounds), taken once by the caller rather than for every pixel.
+    // Check if the pixel buffer exists.
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("Pixel data not valid. Returning...");
         return;
     }
 
-    softLogInfo("softCloseRenderer: Unloading render texture.");
+    // Simple boundary check.
+    if(x < clip.x0 || x >= clip.x1 || y < clip.y0 || y >= clip.y1) { 
+        return; 
+    }
 
-    SDL_DestroyTexture(CORE.Render.render_texture);
+    Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x];
+    *dst = soft_blend_ops[CORE.Config.blend_mode](*dst, pixel);
 
+    if(CORE.Debug.view) {
+        softCountWrites(dst, 1, CORE.Config.blend_mode != BLEND_REPLACE && CORE.Config.blend_mode != BLEND_COLOR_KEY);
+    }
 }
 
-SAPI i32 softInitDefaultPixelBuffer(void) {
-    softLogInfo("softInitDefaultPixelBuffer: Initializing Pixel Buffer.");
+internal void softFillRow(SoftBounds clip, i32 y, i32 x0, i32 x1, Pixel pixel, SoftFillKernel fill) {
+    // Fills the half-open span [x0, x1) of the row [y], clipped to the [clip] bounds.
+    if(y < clip.y0 || y >= clip.y1) {
+        return;
+    }
 
-    if(!CORE.Window.window || !CORE.Render.renderer || !CORE.Render.render_texture) {
-        softLogError("softInitDefaultPixelBuffer: %s", strerror(errno));
+    x0 = SOFT_MAX(x0, clip.x0);
+    x1 = SOFT_MIN(x1, clip.x1);
 
-        softCloseWindow();
-        softCloseRenderer();
-        softClosePlatform();
-        
-        return SOFT_FAILED;
+    if(x0 >= x1) {
+        return;
     }
 
-    CORE.PixelBuffer.size = (iVec2) { CORE.Window.display_size.x, CORE.Window.display_size.y };
-    CORE.PixelBuffer.pixel_buffer = (PixelBuffer)calloc(CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y, sizeof(Pixel));
+    fill(&CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x0], x1 - x0, pixel);
+}
 
-    if(!CORE.PixelBuffer.pixel_buffer) {
-        softLogError("softInitDefaultPixelBuffer: %s", strerror(errno));
+// ------------------------------
+// Anti-aliasing.
+// Coverage is an 8-bit value (0 - 255) computed in integer math. It scales the alpha of the color
+// (or the whole color, when blending premultiplied colors) and the result goes through the regular blend kernels.
+// Partial coverage only means something when it's blended, so BLEND_REPLACE and BLEND_COLOR_KEY fall back to alpha blending here.
+// ------------------------------
 
-        softCloseWindow();
-        softCloseRenderer();
-        softClosePlatform();
-        
-        return SOFT_FAILED;
+typedef struct {
+    Pixel pixel;
+    SoftBlendOp blend;
+    SoftCopyKernel copy;
+    bool premultiplied;
+} SoftCoverageBrush;
+
+internal inline Pixel softApplyCoverage(Pixel pixel, u32 coverage, bool premultiplied) {
+    u32 c = coverage + (coverage >> 7);
+
+    if(premultiplied) {
+        return ((((pixel & 0x00FF00FF) * c) >> 8) & 0x00FF00FF) | ((((pixel >> 8) & 0x00FF00FF) * c) & 0xFF00FF00);
     }
 
-    softLogInfo("   > Pixel count: %i (%i bytes)", CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y, CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y * sizeof(Pixel));
+    return (pixel & 0x00FFFFFF) | ((((pixel >> 24) * c) >> 8) << 24);
+}
 
-    return SOFT_SUCCESS;
+internal SoftCoverageBrush softGetCoverageBrush(Pixel pixel) {
+    SoftBlendMode mode = CORE.Config.blend_mode;
+
+    if(mode == BLEND_REPLACE || mode == BLEND_COLOR_KEY) {
+        mode = BLEND_ALPHA;
+    }
+
+    return (SoftCoverageBrush) { pixel, soft_blend_ops[mode], soft_copy_kernels[mode], mode == BLEND_ALPHA_PREMULTIPLIED };
 }
 
+internal void softCoverageSpan(Pixel* dst, const u8* coverage, i32 count, const SoftCoverageBrush* brush) {
+    // Blends the brush color over [count] destination pixels (at most SOFT_SPAN_CHUNK_SIZE), weighted by the per-pixel [coverage].
+    // Short runs (most of the edge pixels) are blended one by one; longer ones go through the span kernel.
+    if(count < SOFT_COVERAGE_SPAN_MIN) {
+        for(i32 i = 0; i < count; i++) {
+            dst[i] = brush->blend(dst[i], softApplyCoverage(brush->pixel, coverage[i], brush->premultiplied));
+        }
 
-SAPI void softUnloadPixelBuffer(void) {
-    if(!CORE.PixelBuffer.pixel_buffer) {
-        softLogWarning("softUnloadPixelBuffer: Pixel Buffer already unloaded. Returning...");
+        if(CORE.Debug.view) {
+            softCountWrites(dst, count, true);
+        }
 
         return;
     }
 
-    softLogInfo("softUnloadPixelBuffer: Unloading Pixel Buffer.");
+    Pixel row[SOFT_SPAN_CHUNK_SIZE];
+    i32 i = 0;
 
-    free(CORE.PixelBuffer.pixel_buffer);
-}
+#if defined(__SSE2__)
+    if(!brush->premultiplied) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i alpha = _mm_set1_epi16(brush->pixel >> 24);
+        __m128i color = _mm_set1_epi32(brush->pixel & 0x00FFFFFF);
 
-SAPI PixelBuffer softCreatePixelBuffer(i32 width, i32 height) {
-    softLogInfo("softCreatePixelBuffer: Creating a new pixel buffer (%ix%ipx)", width, height);
-    CORE.PixelBuffer.size = (iVec2) { width, height };
-    return (PixelBuffer)calloc(width * height, sizeof(Pixel));
-}
+        for(; i + 4 <= count; i += 4) {
+            u32 coverage4;
+            memcpy(&coverage4, coverage + i, sizeof(u32));
 
-SAPI i32 softSetCurrentPixelBuffer(PixelBuffer pixel_buffer) {
-    if(pixel_buffer == NULL) {
-        softLogError("softCreatePixelBuffer: Invalid new pixel buffer object. Returning...");
+            __m128i c = _mm_unpacklo_epi8(_mm_cvtsi32_si128(coverage4), zero);
+            c = _mm_add_epi16(c, _mm_srli_epi16(c, 7));
 
-        return SOFT_FAILED;
+            __m128i a = _mm_srli_epi16(_mm_mullo_epi16(c, alpha), 8);
+            _mm_storeu_si128((__m128i*)(row + i), _mm_or_si128(color, _mm_slli_epi32(_mm_unpacklo_epi16(a, zero), 24)));
+        }
     }
+#endif
 
-    if(CORE.PixelBuffer.pixel_buffer != NULL) {
-        softLogInfo("softCreatePixelBuffer: Unloading previous pixel buffer.");
-        free(CORE.PixelBuffer.pixel_buffer);
+    for(; i < count; i++) {
+        row[i] = softApplyCoverage(brush->pixel, coverage[i], brush->premultiplied);
     }
 
-    CORE.PixelBuffer.pixel_buffer = pixel_buffer;
-    
-    if(CORE.PixelBuffer.pixel_buffer == NULL) {
-        softLogError("softCreatePixelBuffer: Failed to set the current pixel buffer. Returning...");
-        return SOFT_FAILED;
-    }
-    
-    softLogInfo("softCreatePixelBuffer: Current pixel buffer set successfully.");
-    return SOFT_SUCCESS;
+    brush->copy(dst, row, count);
 }
 
-SAPI bool softWindowShoulClose(void) {
-    return CORE.Window.quit;
-}
+internal void softCoveragePixel(SoftBounds clip, i32 x, i32 y, u32 coverage, const SoftCoverageBrush* brush) {
+    if(coverage == 0 || x < clip.x0 || y < clip.y0 || x >= clip.x1 || y >= clip.y1) {
+        return;
+    }
 
-SAPI void softCloseCallback(void) {
-    CORE.Window.quit = true;
+    Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x];
+    *dst = brush->blend(*dst, softApplyCoverage(brush->pixel, coverage, brush->premultiplied));
+
+    if(CORE.Debug.view) {
+        softCountWrites(dst, 1, true);
+    }
 }
 
-SAPI iVec2 softGetWindowSize(void){
-    return CORE.Window.screen_size;
+internal i64 softRefineSqrt(i64 value, i64 root) {
+    // Corrects the estimate [root] to the exact floor(sqrt(value)).
+    // Between the neighbouring rows of a circle the root only moves by a few steps, so it's tracked instead of recomputed.
+    if(value <= 0) {
+        return 0;
+    }
+
+    while(root * root > value) {
+        root--;
+    }
+
+    while((root + 1) * (root + 1) <= value) {
+        root++;
+    }
+
+    return root;
 }
 
-SAPI iVec2 softGetWindowCenter(void){
-    return (iVec2) { CORE.Window.screen_size.x / 2, CORE.Window.screen_size.y / 2 };
+internal i64 softFloorSqrt(i64 value) {
+    return value <= 0 ? 0 : softRefineSqrt(value, (i64)(sqrt((d32)(value))));
 }
 
-SAPI iVec2 softGetDisplaySize(void){
-    return CORE.Window.display_size;
+internal void softCircleCoverageRow(SoftBounds clip, i32 y, i32 x0, i32 x1, i64 dx0, i64 dy2, i64 edge, i64 scale, bool ring, const SoftCoverageBrush* brush) {
+    // Edge pixels [x0, x1) of a circle row, in doubled coordinates: [dx0] is the doubled distance of [x0] from the center
+    // and [dy2] is the squared doubled distance of the row.
+    // Filled circles fade out towards the [edge] (outer squared radius); rings fade out on both sides of it.
+    // Both use the squared distance, which is linear enough across a single pixel: d - r ~ (d^2 - r^2) / 2r.
+    if(y < clip.y0 || y >= clip.y1) {
+        return;
+    }
+
+    i32 first = SOFT_MAX(x0, clip.x0);
+    i32 last = SOFT_MIN(x1, clip.x1);
+
+    u8 coverage[SOFT_SPAN_CHUNK_SIZE];
+    Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x];
+
+    for(i32 x = first; x < last; x += SOFT_SPAN_CHUNK_SIZE) {
+        i32 count = SOFT_MIN(SOFT_SPAN_CHUNK_SIZE, last - x);
+        i64 dx = dx0 + 2 * (i64)(x - x0);
+
+        for(i32 i = 0; i < count; i++, dx += 2) {
+            i64 distance = edge - (dx * dx + dy2);
+            i64 weight = ring ? 
+                255 - ((llabs(distance) * scale) >> 16) : 
+                (distance * scale) >> 16;
+
+            coverage[i] = (u8)(SOFT_CLAMP(weight, 0, 255));
+        }
+
+        softCoverageSpan(dst + x, coverage, count, brush);
+    }
 }
 
-SAPI iVec2 softGetDisplayCenter(void){
-    return (iVec2) { CORE.Window.display_size.x / 2, CORE.Window.display_size.y / 2 };
+// ------------------------------
+// Scaled image sampling.
+// Every destination row / column maps to a source coordinate through a 32.32 fixed-point line: start + index * step.
+// The ranges of indices that land inside of both the image and the clip rectangle are solved once per draw call,
+// so the inner loops only step the coordinate and never test it.
+// ------------------------------
+
+typedef struct {
+    i64 start;      // Source coordinate (32.32) of the center of the destination pixel 0
+    i64 step;       // Source distance (32.32) between two neighbouring destination pixels
+    i32 first;      // First visible destination index
+    i32 last;       // One past the last visible destination index
+    i32 src_min;    // Source pixel range the samples may read from (inclusive)
+    i32 src_max;
+} SoftAxisMap;
+
+internal i64 softFloorDiv(i64 a, i64 b) {
+    i64 q = a / b;
+
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
 }
 
-SAPI void softSetConfigFlags(softConfigFlags flags) {
-    CORE.Window.config_flags |= flags;
+internal i64 softCeilDiv(i64 a, i64 b) {
+    return -softFloorDiv(-a, b);
 }
 
-SAPI void softSetWindowTitle(const string title) {
-    SDL_SetWindowTitle(CORE.Window.window, title);
-    strcpy(CORE.Window.title, title);
+internal void softSolveSpan(i64 start, i64 step, i64 lo, i64 hi, i64* first, i64* last) {
+    // Narrows the index range [first, last) to the indices [i] for which: lo <= start + i * step < hi.
+    if(step > 0) {
+        *first = SOFT_MAX(*first, softCeilDiv(lo - start, step));
+        *last = SOFT_MIN(*last, softCeilDiv(hi - start, step));
+    } else if(step < 0) {
+        *first = SOFT_MAX(*first, softFloorDiv(start - hi, -step) + 1);
+        *last = SOFT_MIN(*last, softFloorDiv(start - lo, -step) + 1);
+    } else if(start < lo || start >= hi) {
+        *last = *first;
+    }
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+internal bool softMapAxis(i32 dst_pos, i32 dst_size, i32 src_pos, i32 src_size, i32 image_size, i32 clip_min, i32 clip_max, SoftAxisMap* map) {
+    // Negative source size means that the axis is flipped.
+    i32 src_length = abs(src_size);
+    // Both values are rounded up: the accumulated error then always stays positive and far below the gap between
+    // a sample and the next texel edge, so the samples land exactly where the floating-point math would put them.
+    i64 step = softCeilDiv((i64)(src_length) * SOFT_FIXED_ONE, dst_size);
+    i64 half_step = softCeilDiv((i64)(src_length) * SOFT_FIXED_HALF, dst_size);
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_EVENTS
-// ------------------------------------------------------
+    map->step = src_size < 0 ? -step : step;
+    map->start = src_size < 0 ? 
+        (i64)(src_pos + src_length) * SOFT_FIXED_ONE - half_step : 
+        (i64)(src_pos) * SOFT_FIXED_ONE + half_step;
 
+    map->src_min = SOFT_MAX(src_pos, 0);
+    map->src_max = SOFT_MIN(src_pos + src_length, image_size) - 1;
 
-SAPI void softPollEvents(void) {
-    for(i32 key = 0; key < SOFT_KEYCODE_COUNT_TOTAL; key++) {
-        CORE.Input.Keyboard.key_pressed_previous[key] = CORE.Input.Keyboard.key_pressed_current[key];
+    if(map->src_min > map->src_max) {
+        return false;
     }
 
-    for(i32 button = 0; button < SOFT_MOUSEBUTTON_COUNT_TOTAL; button++) {
-        CORE.Input.Mouse.mouse_button_pressed_previous[button] = CORE.Input.Mouse.mouse_button_pressed_current[button];
-    }
+    // Destination range, limited by the clip rectangle...
+    i64 first = SOFT_MAX(0, clip_min - dst_pos);
+    i64 last = SOFT_MIN(dst_size, clip_max - dst_pos);
+
+    // ...and by the indices that sample inside of [src_min, src_max].
+    softSolveSpan(
+        map->start, 
+        map->step, 
+        (i64)(map->src_min) * SOFT_FIXED_ONE, 
+        (i64)(map->src_max + 1) * SOFT_FIXED_ONE, 
+        &first, 
+        &last
+    );
 
-    SDL_Event event = { 0 };
-    while(SDL_PollEvent(&event)) {
-        switch(event.type) {
-            case SDL_WINDOWEVENT:
-                switch (event.window.event) {
-                    case SDL_WINDOWEVENT_SIZE_CHANGED:
-                        CORE.Window.screen_size.x = event.window.data1;
-                        CORE.Window.screen_size.y = event.window.data2;
+    map->first = first;
+    map->last = last;
 
-                        CORE.Window.screen_display_size_delta.x = CORE.Window.display_size.x - CORE.Window.screen_size.x;
-                        CORE.Window.screen_display_size_delta.y = CORE.Window.display_size.y - CORE.Window.screen_size.y;
+    return first < last;
+}
 
-                        break;
+internal void softDrawImageNearest(Image* image, Rect dest, SoftAxisMap map_x, SoftAxisMap map_y, Pixel tint) {
+    SoftCopyKernel copy = softGetCopyKernel();
+    i32 count = map_x.last - map_x.first;
+    bool tinted = !softPixelCompare(tint, WHITE);
 
-                    case SDL_WINDOWEVENT_CLOSE:
-                        softCloseCallback();
-                        
-                        break;
+    // Integer upscaling (each source pixel covers exactly [scale] destination pixels) duplicates the pixels instead of stepping the coordinate.
+    i32 scale = map_x.step > 0 && SOFT_FIXED_ONE % map_x.step == 0 ? SOFT_FIXED_ONE / map_x.step : 0;
+    i32 src_x_origin = (map_x.start - map_x.step / 2) >> SOFT_FIXED_SHIFT;
 
-                    case SDL_WINDOWEVENT_ENTER:
-                        CORE.Window.cursor_on_screen = true;
-                        
-                        break;
+    // Unscaled rows can be blended straight from the image data.
+    bool direct = scale == 1 && !tinted;
 
-                    case SDL_WINDOWEVENT_LEAVE:
-                        CORE.Window.cursor_on_screen = false;
-                        
-                        break;
-                }
+    SoftArenaMark mark = softFrameMark();
+    Pixel* row = direct ? NULL : (Pixel*)softFrameAlloc(count * sizeof(Pixel));
+    const Pixel* row_source = NULL;
 
-                break;
+    if(!direct && !row) {
+        return;
+    }
 
-            case SDL_KEYDOWN: {
-                softKeyCode key = SDLScancodeToSoftKeyCode(event.key.keysym.scancode);
+    for(i32 j = map_y.first; j < map_y.last; j++) {
+        i32 src_y = (map_y.start + j * map_y.step) >> SOFT_FIXED_SHIFT;
+        const Pixel* src = &image->data[src_y * image->size.x];
+        Pixel* dst = &CORE.PixelBuffer.pixel_buffer[(dest.position.y + j) * CORE.PixelBuffer.size.x + dest.position.x + map_x.first];
 
-                if(key != KEY_NULL && key < SOFT_KEYCODE_COUNT_TOTAL) {
-                    CORE.Input.Keyboard.key_pressed_current[key] = true;
-                }
+        if(direct) {
+            copy(dst, src + src_x_origin + map_x.first, count);
+            continue;
+        }
 
-                if(softKeyPressed(CORE.Input.Keyboard.exit_key)) {
-                    softCloseCallback();
+        // Upscaled images repeat the same source row several times; it's resampled only once.
+        if(src != row_source) {
+            if(scale > 0) {
+                for(i32 i = map_x.first, n = 0; i < map_x.last;) {
+                    Pixel pixel = src[src_x_origin + i / scale];
+                    i32 run_end = SOFT_MIN((i / scale + 1) * scale, map_x.last);
+
+                    for(; i < run_end; i++) {
+                        row[n++] = pixel;
+                    }
                 }
+            } else {
+                i64 u = map_x.start + map_x.first * map_x.step;
 
-                break;
+                for(i32 n = 0; n < count; n++, u += map_x.step) {
+                    row[n] = src[u >> SOFT_FIXED_SHIFT];
+                }
             }
 
-            case SDL_KEYUP: {
-                softKeyCode key = SDLScancodeToSoftKeyCode(event.key.keysym.scancode);
+            if(tinted) {
+                softTintSpan(row, row, count, tint);
+            }
 
-                if(key != KEY_NULL && key < SOFT_KEYCODE_COUNT_TOTAL) {
-                    CORE.Input.Keyboard.key_pressed_current[key] = false;
-                }
+            row_source = src;
+        }
 
-                break;
-            }
+        copy(dst, row, count);
+    }
 
-            case SDL_MOUSEMOTION:
-                CORE.Input.Mouse.position_previous = CORE.Input.Mouse.position_current;
+    softFrameRelease(mark);
+}
 
-                CORE.Input.Mouse.position_current.x = event.motion.x;
-                CORE.Input.Mouse.position_current.y = event.motion.y;
-                
-                break;
+internal void softDrawImageBilinear(Image* image, Rect dest, SoftAxisMap map_x, SoftAxisMap map_y, Pixel tint) {
+    SoftCopyKernel copy = softGetCopyKernel();
+    i32 count = map_x.last - map_x.first;
+    bool tinted = !softPixelCompare(tint, WHITE);
 
-            case SDL_MOUSEWHEEL:
-                CORE.Input.Mouse.wheel_move.x = event.wheel.x;
-                CORE.Input.Mouse.wheel_move.y = event.wheel.y;
-                
-                break;
+    // Source columns read by the visible part of every row (the samples are shifted by half a pixel to get the texel centers).
+    i64 u_first = map_x.start + map_x.first * map_x.step - SOFT_FIXED_HALF;
+    i64 u_last = map_x.start + (map_x.last - 1) * map_x.step - SOFT_FIXED_HALF;
+    i32 column_min = SOFT_CLAMP((i32)(SOFT_MIN(u_first, u_last) >> SOFT_FIXED_SHIFT), map_x.src_min, map_x.src_max);
+    i32 column_max = SOFT_CLAMP((i32)(SOFT_MAX(u_first, u_last) >> SOFT_FIXED_SHIFT) + 1, map_x.src_min, map_x.src_max);
+    i32 column_count = column_max - column_min + 1;
 
-            case SDL_MOUSEBUTTONDOWN: {
-                softMouseButtons button;
+    SoftArenaMark mark = softFrameMark();
+    Pixel* row = (Pixel*)softFrameAlloc((count + column_count) * sizeof(Pixel));
 
-                if(event.button.button == SDL_BUTTON_LEFT) button = BUTTON_LEFT;
-                else if(event.button.button == SDL_BUTTON_MIDDLE) button = BUTTON_MIDDLE;
-                else if(event.button.button == SDL_BUTTON_RIGHT) button = BUTTON_RIGHT;
+    if(!row) {
+        return;
+    }
 
-                CORE.Input.Mouse.mouse_button_pressed_current[button] = true;
-                
-                break;
-            }
+    Pixel* column = row + count;
+
+    i64 u_min = (i64)(map_x.src_min) * SOFT_FIXED_ONE;
+    i64 u_max = (i64)(map_x.src_max) * SOFT_FIXED_ONE;
+    i64 v_min = (i64)(map_y.src_min) * SOFT_FIXED_ONE;
+    i64 v_max = (i64)(map_y.src_max) * SOFT_FIXED_ONE;
+
+    for(i32 j = map_y.first; j < map_y.last; j++) {
+        i64 v = SOFT_CLAMP(map_y.start + j * map_y.step - SOFT_FIXED_HALF, v_min, v_max);
+        i32 y0 = v >> SOFT_FIXED_SHIFT;
+        i32 y1 = SOFT_MIN(y0 + 1, map_y.src_max);
+
+        // Vertical pass: a contiguous span of the two source rows, blended with SIMD.
+        softLerpSpan(
+            column, 
+            &image->data[y0 * image->size.x + column_min], 
+            &image->data[y1 * image->size.x + column_min], 
+            column_count, 
+            (v >> (SOFT_FIXED_SHIFT - 8)) & 0xFF
+        );
 
-            case SDL_MOUSEBUTTONUP:{
-                softMouseButtons button;
+        // Horizontal pass: the fixed-point coordinate picks two neighbouring columns and their weight.
+        i64 u = map_x.start + map_x.first * map_x.step - SOFT_FIXED_HALF;
 
-                if(event.button.button == SDL_BUTTON_LEFT) button = BUTTON_LEFT;
-                else if(event.button.button == SDL_BUTTON_MIDDLE) button = BUTTON_MIDDLE;
-                else if(event.button.button == SDL_BUTTON_RIGHT) button = BUTTON_RIGHT;
+        for(i32 n = 0; n < count; n++, u += map_x.step) {
+            i64 u_clamped = SOFT_CLAMP(u, u_min, u_max);
+            i32 x0 = (u_clamped >> SOFT_FIXED_SHIFT) - column_min;
+            i32 x1 = SOFT_MIN(x0 + 1, column_count - 1);
 
-                CORE.Input.Mouse.mouse_button_pressed_current[button] = false;
+            row[n] = softLerpPixel(column[x0], column[x1], (u_clamped >> (SOFT_FIXED_SHIFT - 8)) & 0xFF);
+        }
 
-                break;
-            }
+        if(tinted) {
+            softTintSpan(row, row, count, tint);
         }
+
+        copy(&CORE.PixelBuffer.pixel_buffer[(dest.position.y + j) * CORE.PixelBuffer.size.x + dest.position.x + map_x.first], row, count);
     }
+
+    softFrameRelease(mark);
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+// ------------------------------
+// Affine (rotated / scaled) drawing.
+// The destination pixel centers are mapped back to the local space of the source rectangle (u, v).
+// Both coordinates are linear in the destination [x], so every scanline solves its visible span once
+// and then only adds the fixed-point increments, instead of multiplying a matrix per pixel.
+// ------------------------------
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_INPUT
-// ------------------------------------------------------
+typedef struct {
+    i64 u;              // Local source coordinates (32.32) of the center of the destination pixel (0, 0)
+    i64 v;
+    i64 du_dx;          // Local source steps (32.32) between the neighbouring destination pixels
+    i64 dv_dx;
+    i64 du_dy;
+    i64 dv_dy;
+    i64 width;          // Size of the source rectangle (32.32)
+    i64 height;
+    SoftBounds bounds;  // Clipped destination bounding box of the mapped rectangle
+} SoftAffineMap;
+
+internal i64 softToFixed(d32 value) {
+    return (i64)(llround(value * SOFT_FIXED_ONE));
+}
 
+internal void softRotationSinCos(f32 rotation, d32* c, d32* s) {
+    // [rotation] is given in degrees.
+    // Multiples of 90 degrees get exact sine / cosine values, so the quarter turns map the pixels 1:1.
+    d32 angle = fmod(rotation, 360.0);
+    if(angle < 0.0) {
+        angle += 360.0;
+    }
 
-SAPI iVec2 softGetMousePosition(void) {
-    return (iVec2) {
-        (CORE.Input.Mouse.position_current.x + CORE.Input.Mouse.offset.x) * CORE.Input.Mouse.scale.x,
-        (CORE.Input.Mouse.position_current.y + CORE.Input.Mouse.offset.y) * CORE.Input.Mouse.scale.y
+    *c = cos(angle * PI / 180.0);
+    *s = sin(angle * PI / 180.0);
+
+    d32 quarter = round(angle / 90.0);
+    if(fabs(angle - quarter * 90.0) < 1e-4) {
+        const d32 quarter_cos[4] = { 1.0, 0.0, -1.0, 0.0 };
+        const d32 quarter_sin[4] = { 0.0, 1.0, 0.0, -1.0 };
+
+        *c = quarter_cos[(i32)(quarter) % 4];
+        *s = quarter_sin[(i32)(quarter) % 4];
+    }
+}
+
+internal bool softBuildAffineMap(f32 position_x, f32 position_y, f32 pivot_x, f32 pivot_y, iVec2 size, f32 rotation, f32 scale_x, f32 scale_y, SoftBounds clip, SoftAffineMap* map) {
+    if(size.x <= 0 || size.y <= 0 || scale_x == 0.0f || scale_y == 0.0f) {
+        return false;
+    }
+
+    // Forward mapping: destination = position + R(rotation) * S(scale) * (local - pivot).
+    d32 c, s;
+    softRotationSinCos(rotation, &c, &s);
+
+    // Destination bounding box of the four corners.
+    d32 min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+    const i32 corners[4][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+
+    for(i32 i = 0; i < 4; i++) {
+        d32 lx = (corners[i][0] * size.x - pivot_x) * scale_x;
+        d32 ly = (corners[i][1] * size.y - pivot_y) * scale_y;
+        d32 dx = position_x + c * lx - s * ly;
+        d32 dy = position_y + s * lx + c * ly;
+
+        min_x = fmin(min_x, dx);
+        min_y = fmin(min_y, dy);
+        max_x = fmax(max_x, dx);
+        max_y = fmax(max_y, dy);
+    }
+
+    map->bounds.x0 = SOFT_MAX(clip.x0, (i32)(floor(min_x)));
+    map->bounds.y0 = SOFT_MAX(clip.y0, (i32)(floor(min_y)));
+    map->bounds.x1 = SOFT_MIN(clip.x1, (i32)(ceil(max_x)));
+    map->bounds.y1 = SOFT_MIN(clip.y1, (i32)(ceil(max_y)));
+
+    if(softClipBoundsEmpty(map->bounds)) {
+        return false;
+    }
+
+    // Inverse mapping: local = pivot + S^-1 * R^-1 * (destination - position), evaluated at the pixel center (0.5, 0.5).
+    d32 ox = 0.5 - position_x;
+    d32 oy = 0.5 - position_y;
+
+    map->u = softToFixed(pivot_x + (c * ox + s * oy) / scale_x);
+    map->v = softToFixed(pivot_y + (-s * ox + c * oy) / scale_y);
+    map->du_dx = softToFixed(c / scale_x);
+    map->du_dy = softToFixed(s / scale_x);
+    map->dv_dx = softToFixed(-s / scale_y);
+    map->dv_dy = softToFixed(c / scale_y);
+    map->width = (i64)(size.x) * SOFT_FIXED_ONE;
+    map->height = (i64)(size.y) * SOFT_FIXED_ONE;
+
+    return true;
+}
+
+internal bool softAffineRow(const SoftAffineMap* map, i32 y, i32* x_first, i32* x_last, i64* u, i64* v) {
+    // Visible span of the row [y] and the local coordinates of its first pixel.
+    i64 row_u = map->u + (i64)(map->bounds.x0) * map->du_dx + (i64)(y) * map->du_dy;
+    i64 row_v = map->v + (i64)(map->bounds.x0) * map->dv_dx + (i64)(y) * map->dv_dy;
+
+    i64 first = 0;
+    i64 last = map->bounds.x1 - map->bounds.x0;
+
+    softSolveSpan(row_u, map->du_dx, 0, map->width, &first, &last);
+    softSolveSpan(row_v, map->dv_dx, 0, map->height, &first, &last);
+
+    if(first >= last) {
+        return false;
+    }
+
+    *x_first = map->bounds.x0 + first;
+    *x_last = map->bounds.x0 + last;
+    *u = row_u + first * map->du_dx;
+    *v = row_v + first * map->dv_dx;
+
+    return true;
+}
+
+internal void softFillAffine(const SoftAffineMap* map, Pixel pixel, SoftFillKernel fill) {
+    for(i32 y = map->bounds.y0; y < map->bounds.y1; y++) {
+        i32 x_first, x_last;
+        i64 u, v;
+
+        if(softAffineRow(map, y, &x_first, &x_last, &u, &v)) {
+            fill(&CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x_first], x_last - x_first, pixel);
+        }
+    }
+}
+
+internal void softDrawImageAffine(Image* image, Rect source, const SoftAffineMap* map, Pixel tint) {
+    SoftCopyKernel copy = softGetCopyKernel();
+    bool tinted = !softPixelCompare(tint, WHITE);
+
+    // Quarter turns without scaling step through the source by whole pixels, so they walk a plain pointer with a fixed stride.
+    bool axis_aligned = 
+        (map->du_dx == 0 || llabs(map->du_dx) == SOFT_FIXED_ONE) && 
+        (map->dv_dx == 0 || llabs(map->dv_dx) == SOFT_FIXED_ONE);
+
+    i32 pitch = image->size.x;
+    i32 stride = (map->dv_dx / SOFT_FIXED_ONE) * pitch + (map->du_dx / SOFT_FIXED_ONE);
+    const Pixel* origin = &image->data[source.position.y * pitch + source.position.x];
+
+    i64 du_dx = map->du_dx;
+    i64 dv_dx = map->dv_dx;
+
+    Pixel row[SOFT_SPAN_CHUNK_SIZE];
+
+    for(i32 y = map->bounds.y0; y < map->bounds.y1; y++) {
+        i32 x_first, x_last;
+        i64 u, v;
+
+        if(!softAffineRow(map, y, &x_first, &x_last, &u, &v)) {
+            continue;
+        }
+
+        Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x];
+
+        for(i32 x = x_first; x < x_last; x += SOFT_SPAN_CHUNK_SIZE) {
+            i32 count = SOFT_MIN(SOFT_SPAN_CHUNK_SIZE, x_last - x);
+
+            if(axis_aligned) {
+                const Pixel* src = &origin[(v >> SOFT_FIXED_SHIFT) * pitch + (u >> SOFT_FIXED_SHIFT)];
+
+                for(i32 i = 0; i < count; i++, src += stride) {
+                    row[i] = *src;
+                }
+            } else {
+                for(i32 i = 0; i < count; i++) {
+                    row[i] = origin[(i32)(v >> SOFT_FIXED_SHIFT) * pitch + (i32)(u >> SOFT_FIXED_SHIFT)];
+
+                    u += du_dx;
+                    v += dv_dx;
+                }
+            }
+
+            if(tinted) {
+                softTintSpan(row, row, count, tint);
+            }
+
+            copy(dst + x, row, count);
+
+            if(axis_aligned) {
+                u += count * du_dx;
+                v += count * dv_dx;
+            }
+        }
+    }
+}
+
+// ------------------------------
+// 2D camera.
+// Between softBeginMode2D and softEndMode2D every primitive is given in world space:
+// screen = offset + zoom * R(rotation) * (world - target).
+// Culling happens in world space: the clip area is mapped back to a world-space bounding box (only when the clip changes),
+// so rejecting an object costs four comparisons and no transform at all.
+// ------------------------------
+
+internal void softCameraToScreen(Camera2D camera, d32 c, d32 s, d32 x, d32 y, d32* screen_x, d32* screen_y) {
+    d32 dx = (x - camera.target.x) * camera.zoom;
+    d32 dy = (y - camera.target.y) * camera.zoom;
+
+    *screen_x = camera.offset.x + c * dx - s * dy;
+    *screen_y = camera.offset.y + s * dx + c * dy;
+}
+
+internal void softCameraToWorld(Camera2D camera, d32 c, d32 s, d32 x, d32 y, d32* world_x, d32* world_y) {
+    d32 dx = x - camera.offset.x;
+    d32 dy = y - camera.offset.y;
+
+    *world_x = camera.target.x + (c * dx + s * dy) / camera.zoom;
+    *world_y = camera.target.y + (-s * dx + c * dy) / camera.zoom;
+}
+
+internal SoftBounds softCameraView(void) {
+    // The view is invalidated whenever the camera, the clip stack or the pixel buffer changes.
+    if(!CORE.Camera.view_valid) {
+        SoftBounds clip = softGetClipBounds();
+        d32 min_x = INFINITY, min_y = INFINITY, max_x = -INFINITY, max_y = -INFINITY;
+        const i32 corners[4][2] = { { clip.x0, clip.y0 }, { clip.x1, clip.y0 }, { clip.x0, clip.y1 }, { clip.x1, clip.y1 } };
+
+        for(i32 i = 0; i < 4; i++) {
+            d32 world_x, world_y;
+            softCameraToWorld(CORE.Camera.camera, CORE.Camera.cos, CORE.Camera.sin, corners[i][0], corners[i][1], &world_x, &world_y);
+
+            min_x = fmin(min_x, world_x);
+            min_y = fmin(min_y, world_y);
+            max_x = fmax(max_x, world_x);
+            max_y = fmax(max_y, world_y);
+        }
+
+        // One pixel of margin covers the rounding of the transformed primitives.
+        CORE.Camera.view = (SoftBounds) { (i32)(floor(min_x)) - 1, (i32)(floor(min_y)) - 1, (i32)(ceil(max_x)) + 1, (i32)(ceil(max_y)) + 1 };
+
+        // Nothing is visible: an inverted view rejects every object.
+        if(softClipBoundsEmpty(clip)) {
+            CORE.Camera.view = (SoftBounds) { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+        }
+
+        CORE.Camera.view_valid = true;
+    }
+
+    return CORE.Camera.view;
+}
+
+internal bool softCameraCulls(i32 x0, i32 y0, i32 x1, i32 y1) {
+    return softClipRejects(softCameraView(), x0, y0, x1, y1);
+}
+
+internal iVec2 softCameraPoint(iVec2 point) {
+    if(CORE.Camera.translation_only) {
+        return softVectorAdd(point, CORE.Camera.translation);
+    }
+
+    d32 screen_x, screen_y;
+    softCameraToScreen(CORE.Camera.camera, CORE.Camera.cos, CORE.Camera.sin, point.x, point.y, &screen_x, &screen_y);
+
+    return (iVec2) { (i32)(floor(screen_x + 0.5)), (i32)(floor(screen_y + 0.5)) };
+}
+
+internal i32 softCameraPivotRadius(iVec2 size, iVec2 pivot) {
+    // Distance from the pivot to the farthest corner: bounds the rectangle at any rotation.
+    d32 dx = SOFT_MAX(abs(pivot.x), abs(size.x - pivot.x));
+    d32 dy = SOFT_MAX(abs(pivot.y), abs(size.y - pivot.y));
+
+    return (i32)(ceil(sqrt(dx * dx + dy * dy)));
+}
+
+internal bool softBuildViewAffineMap(f32 position_x, f32 position_y, f32 pivot_x, f32 pivot_y, iVec2 size, f32 rotation, f32 scale_x, f32 scale_y, SoftAffineMap* map) {
+    // The active camera is folded into the primitive's own transform: its rotation and zoom are applied around the mapped [position].
+    if(CORE.Camera.active) {
+        d32 screen_x, screen_y;
+        softCameraToScreen(CORE.Camera.camera, CORE.Camera.cos, CORE.Camera.sin, position_x, position_y, &screen_x, &screen_y);
+
+        position_x = screen_x;
+        position_y = screen_y;
+        rotation += CORE.Camera.camera.rotation;
+        scale_x *= CORE.Camera.camera.zoom;
+        scale_y *= CORE.Camera.camera.zoom;
+    }
+
+    return softBuildAffineMap(position_x, position_y, pivot_x, pivot_y, size, rotation, scale_x, scale_y, softGetClipBounds(), map);
+}
+
+internal void softDrawImageProRotatedView(Image* image, Rect source, Rect dest, Pixel tint) {
+    // softDrawImagePro under a rotated camera: nearest sampling through the affine mapper.
+    // A negative source size flips the axis (negative scale, pivot on the far side), and the source is clamped to the image,
+    // which shifts the pivot by the amount cut off.
+    i32 src_x0 = source.position.x;
+    i32 src_y0 = source.position.y;
+    i32 src_x1 = source.position.x + abs(source.size.x);
+    i32 src_y1 = source.position.y + abs(source.size.y);
+
+    i32 clamped_x0 = SOFT_MAX(src_x0, 0);
+    i32 clamped_y0 = SOFT_MAX(src_y0, 0);
+    i32 clamped_x1 = SOFT_MIN(src_x1, image->size.x);
+    i32 clamped_y1 = SOFT_MIN(src_y1, image->size.y);
+
+    if(clamped_x0 >= clamped_x1 || clamped_y0 >= clamped_y1) {
+        return;
+    }
+
+    f32 scale_x = (f32)(dest.size.x) / source.size.x;
+    f32 scale_y = (f32)(dest.size.y) / source.size.y;
+
+    f32 pivot_x = (scale_x < 0.0f ? src_x1 - src_x0 : 0) - (clamped_x0 - src_x0);
+    f32 pivot_y = (scale_y < 0.0f ? src_y1 - src_y0 : 0) - (clamped_y0 - src_y0);
+
+    Rect clamped = { (iVec2) { clamped_x0, clamped_y0 }, (iVec2) { clamped_x1 - clamped_x0, clamped_y1 - clamped_y0 } };
+
+    SoftAffineMap map = { 0 };
+    if(softBuildViewAffineMap(dest.position.x, dest.position.y, pivot_x, pivot_y, clamped.size, 0.0f, scale_x, scale_y, &map)) {
+        softDrawImageAffine(image, clamped, &map, tint);
+    }
+}
+
+// ------------------------------
+// Triangles.
+// Half-space rasterizer: a pixel is inside when its center lies on the inner side of all three edges.
+// The edge functions are evaluated in doubled integer coordinates (the pixel centers become odd numbers), so they're exact,
+// and the top-left rule biases the edges that don't own their pixels, which keeps shared edges watertight.
+// The bounding box is walked in 8x8 blocks: blocks outside of an edge are rejected as a whole, the pixel masks of a scanline
+// are only evaluated (with SIMD) in the blocks at both ends of its span, and everything between them is emitted as a single span.
+// ------------------------------
+
+typedef struct {
+    i64 step_x;         // Change of the edge function between the neighbouring pixels
+    i64 step_y;
+    i64 offset;         // Value at the pixel (0, 0)
+    i64 bias;           // 0 for the top-left edges, -1 for the others
+} SoftEdgeFunction;
+
+typedef struct {
+    SoftEdgeFunction edges[3];  // Edge [i] is the one opposite of the vertex [i]: its value is the barycentric weight of that vertex
+    i64 total;                  // Sum of the three edge functions (the same for every pixel)
+    SoftBounds bounds;          // Clipped bounding box
+
+#if defined(__SSE2__)
+    __m128i lanes_lo[3];        // Edge steps of the pixels 0 - 3 and 4 - 7 of a block row
+    __m128i lanes_hi[3];
+#endif
+} SoftTriangleSetup;
+
+typedef struct {
+    Pixel pixel;
+    SoftFillKernel fill;
+    SoftCopyKernel copy;
+
+    i64 channels[4][3];         // Vertex colors: R, G, B, A as 16.16 fixed-point planes (value at the pixel (0, 0), x step, y step)
+
+    Image* image;
+    i64 u[3];                   // Texture coordinates as 32.32 fixed-point planes
+    i64 v[3];
+    Pixel tint;
+} SoftTriangleShader;
+
+typedef void (*SoftTriangleSpan)(const SoftTriangleShader* shader, i32 y, i32 x0, i32 x1);
+
+internal bool softSetupTriangle(Triangle triangle, SoftBounds clip, SoftTriangleSetup* setup) {
+    const iVec2 vertices[3] = { triangle.a, triangle.b, triangle.c };
+
+    for(i32 i = 0; i < 3; i++) {
+        if(abs(vertices[i].x) > SOFT_TRIANGLE_COORD_MAX || abs(vertices[i].y) > SOFT_TRIANGLE_COORD_MAX) {
+            return false;
+        }
+    }
+
+    i64 area = 
+        (i64)(triangle.b.x - triangle.a.x) * (triangle.c.y - triangle.a.y) - 
+        (i64)(triangle.b.y - triangle.a.y) * (triangle.c.x - triangle.a.x);
+
+    if(area == 0) {
+        return false;
+    }
+
+    // Both windings are accepted: the edge functions of the clockwise ones are negated, so the inside is always positive.
+    i64 sign = area > 0 ? 1 : -1;
+
+    setup->total = 0;
+
+    for(i32 i = 0; i < 3; i++) {
+        iVec2 p = vertices[(i + 1) % 3];
+        iVec2 q = vertices[(i + 2) % 3];
+
+        i64 a = -(i64)(q.y - p.y) * sign;
+        i64 b = (i64)(q.x - p.x) * sign;
+
+        // E(x, y) = a * (2x + 1 - 2p.x) + b * (2y + 1 - 2p.y)
+        setup->edges[i].step_x = 2 * a;
+        setup->edges[i].step_y = 2 * b;
+        setup->edges[i].offset = a * (1 - 2 * (i64)(p.x)) + b * (1 - 2 * (i64)(p.y));
+        setup->edges[i].bias = (a > 0 || (a == 0 && b > 0)) ? 0 : -1;
+
+        setup->total += setup->edges[i].offset;
+
+#if defined(__SSE2__)
+        i32 step = (i32)(setup->edges[i].step_x);
+
+        setup->lanes_lo[i] = _mm_set_epi32(3 * step, 2 * step, step, 0);
+        setup->lanes_hi[i] = _mm_set_epi32(7 * step, 6 * step, 5 * step, 4 * step);
+#endif
+    }
+
+    setup->bounds.x0 = SOFT_MAX(clip.x0, SOFT_MIN(SOFT_MIN(triangle.a.x, triangle.b.x), triangle.c.x));
+    setup->bounds.y0 = SOFT_MAX(clip.y0, SOFT_MIN(SOFT_MIN(triangle.a.y, triangle.b.y), triangle.c.y));
+    setup->bounds.x1 = SOFT_MIN(clip.x1, SOFT_MAX(SOFT_MAX(triangle.a.x, triangle.b.x), triangle.c.x));
+    setup->bounds.y1 = SOFT_MIN(clip.y1, SOFT_MAX(SOFT_MAX(triangle.a.y, triangle.b.y), triangle.c.y));
+
+    return !softClipBoundsEmpty(setup->bounds);
+}
+
+internal void softTrianglePlane(const SoftTriangleSetup* setup, d32 value_a, d32 value_b, d32 value_c, d32 scale, i64 plane[3]) {
+    // Fixed-point plane of a vertex attribute: the barycentric weights are the edge functions divided by their sum.
+    const d32 values[3] = { value_a, value_b, value_c };
+    d32 origin = 0.0, step_x = 0.0, step_y = 0.0;
+
+    for(i32 i = 0; i < 3; i++) {
+        origin += (d32)(setup->edges[i].offset) * values[i];
+        step_x += (d32)(setup->edges[i].step_x) * values[i];
+        step_y += (d32)(setup->edges[i].step_y) * values[i];
+    }
+
+    plane[0] = (i64)(llround(origin / setup->total * scale));
+    plane[1] = (i64)(llround(step_x / setup->total * scale));
+    plane[2] = (i64)(llround(step_y / setup->total * scale));
+}
+
+internal bool softTriangleBlockRow(const SoftTriangleSetup* setup, i32 y0, i32 y1, i32* x_first, i32* x_last) {
+    // Columns of the block row [y0, y1) that can be inside of the triangle: for every edge, the best row of the block
+    // has to be inside at the column. Every edge bounds the range from one side, so it takes a single division per edge.
+    i64 first = setup->bounds.x0;
+    i64 last = setup->bounds.x1 - 1;
+
+    for(i32 i = 0; i < 3; i++) {
+        const SoftEdgeFunction* edge = &setup->edges[i];
+        i64 best = edge->offset + edge->bias + SOFT_MAX(edge->step_y * y0, edge->step_y * (y1 - 1));
+
+        if(edge->step_x > 0) {
+            first = SOFT_MAX(first, softCeilDiv(-best, edge->step_x));
+        } else if(edge->step_x < 0) {
+            last = SOFT_MIN(last, softFloorDiv(best, -edge->step_x));
+        } else if(best < 0) {
+            return false;
+        }
+    }
+
+    *x_first = (i32)(first);
+    *x_last = (i32)(last);
+
+    return first <= last;
+}
+
+internal inline u32 softTriangleRowMask(const SoftTriangleSetup* setup, const i64 row[3], i32 x, i32 count) {
+    // Bit [i] is set when the pixel (x + i) of the scanline is inside of the triangle ([count] is at most SOFT_TRIANGLE_BLOCK_SIZE).
+    // [row] holds the (biased) edge values of the scanline at the column 0.
+    // Within a block the edge values fit into 32 bits: values far from an edge are clamped, which keeps their sign.
+    const i64 limit = (i64)(1) << 30;
+    u32 inside = (1u << count) - 1;
+
+#if defined(__SSE2__)
+    __m128i outside_lo = _mm_setzero_si128();
+    __m128i outside_hi = _mm_setzero_si128();
+
+    for(i32 i = 0; i < 3; i++) {
+        i64 value = row[i] + setup->edges[i].step_x * x;
+        __m128i base = _mm_set1_epi32((i32)(SOFT_CLAMP(value, -limit, limit)));
+
+        outside_lo = _mm_or_si128(outside_lo, _mm_add_epi32(base, setup->lanes_lo[i]));
+        outside_hi = _mm_or_si128(outside_hi, _mm_add_epi32(base, setup->lanes_hi[i]));
+    }
+
+    // The sign bit of any edge value marks the pixel as outside.
+    u32 outside = _mm_movemask_ps(_mm_castsi128_ps(outside_lo)) | (_mm_movemask_ps(_mm_castsi128_ps(outside_hi)) << 4);
+
+    return inside & ~outside;
+#else
+    for(i32 i = 0; i < 3; i++) {
+        i64 value = row[i] + setup->edges[i].step_x * x;
+
+        for(i32 lane = 0; lane < count; lane++, value += setup->edges[i].step_x) {
+            if(value < 0) {
+                inside &= ~(1u << lane);
+            }
+        }
+    }
+
+    return inside;
+#endif
+}
+
+internal i32 softLowestBit(u32 mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    i32 bit = 0;
+
+    while(!(mask & 1)) {
+        mask >>= 1;
+        bit++;
+    }
+
+    return bit;
+#endif
+}
+
+internal i32 softHighestBit(u32 mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - __builtin_clz(mask);
+#else
+    i32 bit = 0;
+
+    while(mask >>= 1) {
+        bit++;
+    }
+
+    return bit;
+#endif
+}
+
+internal void softRasterizeTriangle(const SoftTriangleSetup* setup, SoftTriangleSpan span, const SoftTriangleShader* shader) {
+    const SoftBounds bounds = setup->bounds;
+    const i32 block = SOFT_TRIANGLE_BLOCK_SIZE;
+
+    for(i32 block_y = bounds.y0; block_y < bounds.y1; block_y += block) {
+        i32 block_height = SOFT_MIN(block, bounds.y1 - block_y);
+
+        // Blocks outside of the columns reachable in this block row are rejected without looking at them.
+        i32 row_first, row_last;
+        if(!softTriangleBlockRow(setup, block_y, block_y + block_height, &row_first, &row_last)) {
+            continue;
+        }
+
+        i32 block_first = bounds.x0 + (row_first - bounds.x0) / block * block;
+        i32 block_last = bounds.x0 + (row_last - bounds.x0) / block * block;
+
+        i64 row[3];
+        for(i32 i = 0; i < 3; i++) {
+            row[i] = setup->edges[i].offset + setup->edges[i].bias + setup->edges[i].step_y * block_y;
+        }
+
+        for(i32 y = block_y; y < block_y + block_height; y++, row[0] += setup->edges[0].step_y, row[1] += setup->edges[1].step_y, row[2] += setup->edges[2].step_y) {
+            // A triangle is convex, so every scanline covers a single span. Only the blocks at its ends are tested per pixel;
+            // the fully covered blocks between them are filled as a part of the span.
+            i32 x_first = -1;
+            i32 x_last = -1;
+            i32 first_block = block_last;
+
+            for(i32 block_x = block_first; block_x <= block_last; block_x += block) {
+                i32 count = SOFT_MIN(block, bounds.x1 - block_x);
+                u32 mask = softTriangleRowMask(setup, row, block_x, count);
+
+                if(mask) {
+                    x_first = block_x + softLowestBit(mask);
+                    first_block = block_x;
+
+                    // The span ends inside of this block.
+                    if(softHighestBit(mask) < count - 1) {
+                        x_last = block_x + softHighestBit(mask);
+                    }
+
+                    break;
+                }
+            }
+
+            if(x_first < 0) {
+                continue;
+            }
+
+            for(i32 block_x = block_last; x_last < 0 && block_x >= first_block; block_x -= block) {
+                u32 mask = softTriangleRowMask(setup, row, block_x, SOFT_MIN(block, bounds.x1 - block_x));
+
+                if(mask) {
+                    x_last = block_x + softHighestBit(mask);
+                }
+            }
+
+            span(shader, y, x_first, x_last + 1);
+        }
+    }
+}
+
+internal void softTriangleSpanFlat(const SoftTriangleShader* shader, i32 y, i32 x0, i32 x1) {
+    shader->fill(&CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x0], x1 - x0, shader->pixel);
+}
+
+internal void softTriangleSpanColors(const SoftTriangleShader* shader, i32 y, i32 x0, i32 x1) {
+    Pixel row[SOFT_SPAN_CHUNK_SIZE];
+    Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x];
+
+    i32 value[4];
+    i32 step[4];
+
+    for(i32 c = 0; c < 4; c++) {
+        // Inside of the triangle the channels stay within [0, 255] (16.16), so they fit into 32 bits.
+        i64 start = shader->channels[c][0] + shader->channels[c][1] * x0 + shader->channels[c][2] * y;
+
+        value[c] = (i32)(SOFT_CLAMP(start, -(1 << 24), 1 << 24));
+        step[c] = (i32)(shader->channels[c][1]);
+    }
+
+#if defined(__SSE2__)
+    // All four channels are stepped at once; the saturating packs clamp them to [0, 255].
+    __m128i channels = _mm_set_epi32(value[3], value[2], value[1], value[0]);
+    __m128i channels_step = _mm_set_epi32(step[3], step[2], step[1], step[0]);
+#endif
+
+    for(i32 x = x0; x < x1; x += SOFT_SPAN_CHUNK_SIZE) {
+        i32 count = SOFT_MIN(SOFT_SPAN_CHUNK_SIZE, x1 - x);
+
+        for(i32 i = 0; i < count; i++) {
+#if defined(__SSE2__)
+            __m128i packed = _mm_packs_epi32(_mm_srai_epi32(channels, 16), _mm_setzero_si128());
+            row[i] = (Pixel)(_mm_cvtsi128_si32(_mm_packus_epi16(packed, packed)));
+            channels = _mm_add_epi32(channels, channels_step);
+#else
+            Pixel pixel = 0;
+
+            for(i32 c = 0; c < 4; c++) {
+                pixel |= (Pixel)(SOFT_CLAMP(value[c] >> 16, 0, 255)) << (c * 8);
+                value[c] += step[c];
+            }
+
+            row[i] = pixel;
+#endif
+        }
+
+        shader->copy(dst + x, row, count);
+    }
+}
+
+internal void softTriangleSpanTextured(const SoftTriangleShader* shader, i32 y, i32 x0, i32 x1) {
+    Pixel row[SOFT_SPAN_CHUNK_SIZE];
+    Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x];
+
+    const Image* image = shader->image;
+    bool tinted = !softPixelCompare(shader->tint, WHITE);
+
+    i64 u = shader->u[0] + shader->u[1] * x0 + shader->u[2] * y;
+    i64 v = shader->v[0] + shader->v[1] * x0 + shader->v[2] * y;
+
+    for(i32 x = x0; x < x1; x += SOFT_SPAN_CHUNK_SIZE) {
+        i32 count = SOFT_MIN(SOFT_SPAN_CHUNK_SIZE, x1 - x);
+
+        // Nearest sampling; coordinates outside of the image are clamped to its border.
+        for(i32 i = 0; i < count; i++) {
+            i64 texel_x = SOFT_CLAMP(u >> SOFT_FIXED_SHIFT, 0, image->size.x - 1);
+            i64 texel_y = SOFT_CLAMP(v >> SOFT_FIXED_SHIFT, 0, image->size.y - 1);
+
+            row[i] = image->data[texel_y * image->size.x + texel_x];
+
+            u += shader->u[1];
+            v += shader->v[1];
+        }
+
+        if(tinted) {
+            softTintSpan(row, row, count, shader->tint);
+        }
+
+        shader->copy(dst + x, row, count);
+    }
+}
+
+internal bool softCameraTriangle(Triangle* triangle) {
+    // Applies the active camera to the vertices; false when the triangle is culled.
+    if(!CORE.Camera.active) {
+        return true;
+    }
+
+    if(softCameraCulls(
+        SOFT_MIN(SOFT_MIN(triangle->a.x, triangle->b.x), triangle->c.x), 
+        SOFT_MIN(SOFT_MIN(triangle->a.y, triangle->b.y), triangle->c.y), 
+        SOFT_MAX(SOFT_MAX(triangle->a.x, triangle->b.x), triangle->c.x), 
+        SOFT_MAX(SOFT_MAX(triangle->a.y, triangle->b.y), triangle->c.y))) {
+        return false;
+    }
+
+    triangle->a = softCameraPoint(triangle->a);
+    triangle->b = softCameraPoint(triangle->b);
+    triangle->c = softCameraPoint(triangle->c);
+
+    return true;
+}
+
+// ------------------------------
+// Polygons.
+// Scanline filler: the non-horizontal edges are bucketed by their first scanline into an edge table, and every scanline
+// keeps an active edge list sorted by the crossing position, so the spans between the crossings go straight to the fill kernel.
+// A pixel is inside when its center is (the same sampling as the triangles), and the crossings are stepped in 32.32
+// fixed point from the upper vertex of every edge, so polygons sharing an edge split its pixels without gaps or overlaps.
+// The vertices are snapped to 1/256 of a pixel, and a path may hold any number of contours (strokes are built out of many).
+// ------------------------------
+
+typedef struct { d32 x; d32 y; } SoftPoint;
+
+typedef struct {
+    i64 x;              // Crossing of the current scanline's pixel centers (32.32)
+    i64 step;           // Change of the crossing between the scanlines
+    i32 y_first;        // Scanline range of the edge [y_first, y_last)
+    i32 y_last;
+    i32 winding;        // +1 for the edges going down, -1 for the edges going up
+    i32 next;           // Next edge starting on the same scanline (-1 ends the bucket)
+} SoftPolygonEdge;
+
+typedef struct {
+    SoftPolygonEdge* edges;
+    i32 count;
+    i32 capacity;
+    SoftBounds clip;
+    SoftArenaMark mark; // Everything allocated while the path is built is released with it
+    bool valid;         // Cleared by a failed allocation or an out of range vertex
+} SoftPath;
+
+internal bool softAddPolygonEdge(iVec2 p, iVec2 q, i32 winding, SoftBounds clip, SoftPolygonEdge* edge) {
+    // [p], [q]: subpixel coordinates (SOFT_SUBPIXEL_SHIFT fractional bits).
+    // Horizontal edges never cross a pixel center row, so they're dropped.
+    if(p.y == q.y) {
+        return false;
+    }
+
+    iVec2 top = p.y < q.y ? p : q;
+    iVec2 bottom = p.y < q.y ? q : p;
+
+    // The scanlines whose centers y + 0.5 lie in [top.y, bottom.y).
+    edge->y_first = SOFT_MAX((i32)(softCeilDiv(top.y - SOFT_SUBPIXEL_ONE / 2, SOFT_SUBPIXEL_ONE)), clip.y0);
+    edge->y_last = SOFT_MIN((i32)(softCeilDiv(bottom.y - SOFT_SUBPIXEL_ONE / 2, SOFT_SUBPIXEL_ONE)), clip.y1);
+
+    if(edge->y_first >= edge->y_last) {
+        return false;
+    }
+
+    // Both polygons sharing an edge step it from the same vertex, so their crossings are bit-identical.
+    i64 rise = (i64)(edge->y_first) * SOFT_SUBPIXEL_ONE + SOFT_SUBPIXEL_ONE / 2 - top.y;
+
+    edge->step = softFloorDiv((i64)(bottom.x - top.x) * SOFT_FIXED_ONE, bottom.y - top.y);
+    edge->x = (i64)(top.x) * (SOFT_FIXED_ONE / SOFT_SUBPIXEL_ONE) + ((edge->step * rise) >> SOFT_SUBPIXEL_SHIFT);
+    edge->winding = p.y < q.y ? winding : -winding;
+
+    return true;
+}
+
+internal inline i32 softPolygonCrossingPixel(i64 x) {
+    // First pixel whose center is at or after the crossing.
+    return (i32)((x - SOFT_FIXED_HALF + SOFT_FIXED_ONE - 1) >> SOFT_FIXED_SHIFT);
+}
+
+internal void softSortPolygonEdges(SoftPolygonEdge** list, i32 count) {
+    // Insertion sort by the crossing: the lists are nearly sorted, so it's close to linear.
+    for(i32 i = 1; i < count; i++) {
+        SoftPolygonEdge* edge = list[i];
+        i32 j = i - 1;
+
+        for(; j >= 0 && list[j]->x > edge->x; j--) {
+            list[j + 1] = list[j];
+        }
+
+        list[j + 1] = edge;
+    }
+}
+
+internal void softRasterizePolygon(SoftPolygonEdge* edges, i32 edge_count, i32* buckets, SoftPolygonEdge** active, SoftPolygonEdge** incoming, SoftBounds clip, SoftFillRule rule, SoftFillKernel fill, Pixel pixel) {
+    // [active], [incoming]: room for [edge_count] edges each, [buckets]: one per scanline of [clip].
+    // Edge table: one bucket per scanline of the clip area.
+    for(i32 y = clip.y0; y < clip.y1; y++) {
+        buckets[y - clip.y0] = -1;
+    }
+
+    i32 y_first = clip.y1;
+    i32 y_last = clip.y0;
+
+    for(i32 i = 0; i < edge_count; i++) {
+        edges[i].next = buckets[edges[i].y_first - clip.y0];
+        buckets[edges[i].y_first - clip.y0] = i;
+
+        y_first = SOFT_MIN(y_first, edges[i].y_first);
+        y_last = SOFT_MAX(y_last, edges[i].y_last);
+    }
+
+    // Even-odd only looks at the lowest bit of the winding number, nonzero at all of them.
+    i32 rule_mask = rule == FILL_EVEN_ODD ? 1 : ~0;
+    i32 active_count = 0;
+
+    for(i32 y = y_first; y < y_last; y++) {
+        // The active edges only get out of order where they cross; the new ones are sorted on their own and merged in,
+        // so a scanline where many edges start (strokes, dense outlines) doesn't shift the whole list for each of them.
+        softSortPolygonEdges(active, active_count);
+
+        i32 incoming_count = 0;
+
+        for(i32 i = buckets[y - clip.y0]; i != -1; i = edges[i].next) {
+            incoming[incoming_count++] = &edges[i];
+        }
+
+        if(incoming_count > 0) {
+            softSortPolygonEdges(incoming, incoming_count);
+
+            for(i32 i = active_count - 1, j = incoming_count - 1, k = active_count + incoming_count - 1; j >= 0; k--) {
+                active[k] = (i >= 0 && active[i]->x > incoming[j]->x) ? active[i--] : incoming[j--];
+            }
+
+            active_count += incoming_count;
+        }
+
+        Pixel* row = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x];
+        i32 winding = 0;
+        i64 span_start = 0;
+
+        for(i32 i = 0; i < active_count; i++) {
+            bool inside = (winding & rule_mask) != 0;
+
+            winding += active[i]->winding;
+
+            bool inside_next = (winding & rule_mask) != 0;
+
+            if(!inside && inside_next) {
+                span_start = active[i]->x;
+            } else if(inside && !inside_next) {
+                i32 x0 = SOFT_MAX(softPolygonCrossingPixel(span_start), clip.x0);
+                i32 x1 = SOFT_MIN(softPolygonCrossingPixel(active[i]->x), clip.x1);
+
+                if(x0 < x1) {
+                    fill(row + x0, x1 - x0, pixel);
+                }
+            }
+        }
+
+        // Steps the crossings and retires the edges that end on this scanline.
+        i32 kept = 0;
+
+        for(i32 i = 0; i < active_count; i++) {
+            if(active[i]->y_last > y + 1) {
+                active[i]->x += active[i]->step;
+                active[kept++] = active[i];
+            }
+        }
+
+        active_count = kept;
+    }
+}
+
+internal void softPathBegin(SoftPath* path, i32 capacity) {
+    path->count = 0;
+    path->capacity = SOFT_MAX(capacity, 16);
+    path->clip = softGetClipBounds();
+    path->mark = softFrameMark();
+    path->edges = (SoftPolygonEdge*)softFrameAlloc(path->capacity * sizeof(SoftPolygonEdge));
+    path->valid = path->edges != NULL;
+}
+
+internal bool softPathReserve(SoftPath* path, i32 count) {
+    // Makes room for [count] more edges.
+    if(!path->valid) {
+        return false;
+    }
+
+    if(path->count + count > path->capacity) {
+        i32 capacity = SOFT_MAX(path->capacity * 2, path->count + count);
+        SoftPolygonEdge* edges = (SoftPolygonEdge*)softFrameGrow(path->edges, path->capacity * sizeof(SoftPolygonEdge), capacity * sizeof(SoftPolygonEdge));
+
+        if(!edges) {
+            path->valid = false;
+            return false;
+        }
+
+        path->edges = edges;
+        path->capacity = capacity;
+    }
+
+    return true;
+}
+
+internal void softPathAddContour(SoftPath* path, const SoftPoint* points, i32 count, i32 orientation) {
+    // The contour is closed implicitly. [orientation]: 0 keeps the winding of the points, +1 / -1 forces it
+    // (the strokes are unions of positive contours, so the nonzero rule never blends a pixel twice).
+    if(count < 3 || !softPathReserve(path, count)) {
+        return;
+    }
+
+    i32 winding = 1;
+
+    if(orientation != 0) {
+        d32 area = 0.0;
+
+        for(i32 i = 0, j = count - 1; i < count; j = i++) {
+            area += points[j].x * points[i].y - points[i].x * points[j].y;
+        }
+
+        winding = (area < 0.0) == (orientation < 0) ? 1 : -1;
+    }
+
+    const d32 limit = SOFT_POLYGON_COORD_MAX;
+    iVec2 previous = { 0 };
+
+    for(i32 i = -1; i < count; i++) {
+        SoftPoint point = points[i < 0 ? count - 1 : i];
+
+        if(!(fabs(point.x) <= limit && fabs(point.y) <= limit)) {
+            path->valid = false;
+            return;
+        }
+
+        iVec2 snapped = { (i32)(floor(point.x * SOFT_SUBPIXEL_ONE + 0.5)), (i32)(floor(point.y * SOFT_SUBPIXEL_ONE + 0.5)) };
+
+        if(i >= 0 && softAddPolygonEdge(previous, snapped, winding, path->clip, &path->edges[path->count])) {
+            path->count++;
+        }
+
+        previous = snapped;
+    }
+}
+
+internal void softPathFill(SoftPath* path, SoftFillRule rule, Pixel pixel) {
+    // Rasterizes and releases the path.
+    SoftFillKernel fill = softGetFillKernel(pixel);
+
+    if(path->valid && path->count > 0 && fill) {
+        i32 rows = path->clip.y1 - path->clip.y0;
+        SoftPolygonEdge** active = (SoftPolygonEdge**)softFrameAlloc(2 * path->count * sizeof(SoftPolygonEdge*) + rows * sizeof(i32));
+
+        if(active) {
+            softRasterizePolygon(path->edges, path->count, (i32*)(active + 2 * path->count), active, active + path->count, path->clip, rule, fill, pixel);
+        }
+    }
+
+    softFrameRelease(path->mark);
+    path->edges = NULL;
+}
+
+internal SoftPoint softViewPoint(d32 x, d32 y) {
+    // Applies the active camera without rounding to whole pixels.
+    SoftPoint result = { x, y };
+
+    if(CORE.Camera.active) {
+        softCameraToScreen(CORE.Camera.camera, CORE.Camera.cos, CORE.Camera.sin, x, y, &result.x, &result.y);
+    }
+
+    return result;
+}
+
+internal d32 softViewLength(d32 length) {
+    return CORE.Camera.active ? length * CORE.Camera.camera.zoom : length;
+}
+
+internal bool softCameraCullsPoints(const iVec2* points, i32 count, i32 margin) {
+    // Culls the bounding box of [points] grown by [margin] world units.
+    if(!CORE.Camera.active) {
+        return false;
+    }
+
+    i32 x0 = points[0].x, y0 = points[0].y, x1 = points[0].x, y1 = points[0].y;
+
+    for(i32 i = 1; i < count; i++) {
+        x0 = SOFT_MIN(x0, points[i].x);
+        y0 = SOFT_MIN(y0, points[i].y);
+        x1 = SOFT_MAX(x1, points[i].x);
+        y1 = SOFT_MAX(y1, points[i].y);
+    }
+
+    return softCameraCulls(x0 - margin, y0 - margin, x1 + 1 + margin, y1 + 1 + margin);
+}
+
+// ------------------------------
+// Lines and curves.
+// Connected segments are drawn as one polyline: every segment after the first skips its starting pixel,
+// so the joints aren't blended twice.
+// Bezier curves are flattened with the uniform step that Wang's formula picks from the control polygon: n segments keep
+// the flattened curve within SOFT_CURVE_TOLERANCE pixels of the real one, so nearly straight curves get a couple of
+// segments and tight ones get as many as they need. The points are generated by forward differencing (additions only).
+// ------------------------------
+
+typedef struct {
+    iVec2 last;
+    Pixel pixel;
+    SoftBounds clip;
+} SoftPolyline;
+
+internal void softDrawLineSegment(SoftBounds clip, Line line, Pixel pixel, bool skip_first) {
+    // Source: https://en.wikipedia.org/wiki/Digital_differential_analyzer_(graphics_algorithm)
+
+    f32 dx = line.b.x - line.a.x;
+    f32 dy = line.b.y - line.a.y;
+    f32 steps = 0;
+    f32 i = skip_first ? 1 : 0;
+
+    f32 x = 0;
+    f32 y = 0;
+
+    if (abs((i32)(dx)) >= abs((i32)(dy))) {
+        steps = abs((i32)(dx));
+    } else {
+        steps = abs((i32)(dy));
+    }
+
+    if(steps == 0) {
+        if(!skip_first) {
+            softSetPixel(clip, line.a.x, line.a.y, pixel);
+        }
+
+        return;
+    }
+
+    if(softClipRejects(clip, SOFT_MIN(line.a.x, line.b.x), SOFT_MIN(line.a.y, line.b.y), SOFT_MAX(line.a.x, line.b.x) + 1, SOFT_MAX(line.a.y, line.b.y) + 1)) {
+        return;
+    }
+
+    dx = dx / steps;
+    dy = dy / steps;
+
+    // Only walk the steps that can land inside of the clip rectangle (with a pixel of margin for the rounding).
+    // The per-pixel check in softSetPixel takes care of the rest.
+    f32 i_end = steps;
+
+    if(dx != 0) {
+        f32 t0 = (clip.x0 - 1 - line.a.x) / dx;
+        f32 t1 = (clip.x1 + 1 - line.a.x) / dx;
+
+        i = SOFT_MAX(i, floorf(SOFT_MIN(t0, t1)));
+        i_end = SOFT_MIN(i_end, ceilf(SOFT_MAX(t0, t1)));
+    }
+
+    if(dy != 0) {
+        f32 t0 = (clip.y0 - 1 - line.a.y) / dy;
+        f32 t1 = (clip.y1 + 1 - line.a.y) / dy;
+
+        i = SOFT_MAX(i, floorf(SOFT_MIN(t0, t1)));
+        i_end = SOFT_MIN(i_end, ceilf(SOFT_MAX(t0, t1)));
+    }
+
+    x = line.a.x + dx * i;
+    y = line.a.y + dy * i;
+
+    // Rounded rather than truncated: the accumulated float error must not move the endpoints (the polylines rely on them).
+    while (i <= i_end) {
+        softSetPixel(clip, (i32)(floorf(x + 0.5f)), (i32)(floorf(y + 0.5f)), pixel);
+        x += dx;
+        y += dy;
+        i++;
+    }
+}
+
+internal void softPolylineBegin(SoftPolyline* polyline, iVec2 point, Pixel pixel) {
+    polyline->last = point;
+    polyline->pixel = pixel;
+    polyline->clip = softGetClipBounds();
+
+    softSetPixel(polyline->clip, point.x, point.y, pixel);
+}
+
+internal void softPolylineTo(SoftPolyline* polyline, iVec2 point) {
+    if(softVectorCompare(point, polyline->last)) {
+        return;
+    }
+
+    softDrawLineSegment(polyline->clip, (Line) { polyline->last, point }, polyline->pixel, true);
+    polyline->last = point;
+}
+
+internal i32 softFlattenBezier(const SoftPoint* control, i32 degree, SoftPoint* points) {
+    // [control]: degree + 1 control points; [points]: room for SOFT_CURVE_SEGMENTS_MAX + 1 points. Returns the point count.
+    d32 deviation = 0.0;
+
+    for(i32 i = 0; i + 2 <= degree; i++) {
+        deviation = fmax(deviation, hypot(control[i].x - 2.0 * control[i + 1].x + control[i + 2].x, control[i].y - 2.0 * control[i + 1].y + control[i + 2].y));
+    }
+
+    d32 segments = ceil(sqrt(degree * (degree - 1) / 8.0 * deviation / SOFT_CURVE_TOLERANCE));
+    i32 n = (i32)(SOFT_CLAMP(segments, 1.0, (d32)(SOFT_CURVE_SEGMENTS_MAX)));
+
+    // Power basis: P(t) = a * t^3 + b * t^2 + c * t + P0, and its forward differences for the step h.
+    d32 h = 1.0 / n;
+    d32 value[2], delta[2], delta2[2], delta3[2];
+
+    for(i32 k = 0; k < 2; k++) {
+        d32 p[4];
+
+        for(i32 i = 0; i <= degree; i++) {
+            p[i] = k == 0 ? control[i].x : control[i].y;
+        }
+
+        d32 a = degree == 3 ? p[3] - 3.0 * p[2] + 3.0 * p[1] - p[0] : 0.0;
+        d32 b = degree == 3 ? 3.0 * (p[2] - 2.0 * p[1] + p[0]) : p[2] - 2.0 * p[1] + p[0];
+        d32 c = degree == 3 ? 3.0 * (p[1] - p[0]) : 2.0 * (p[1] - p[0]);
+
+        value[k] = p[0];
+        delta[k] = a * h * h * h + b * h * h + c * h;
+        delta2[k] = 6.0 * a * h * h * h + 2.0 * b * h * h;
+        delta3[k] = 6.0 * a * h * h * h;
+    }
+
+    points[0] = control[0];
+
+    for(i32 i = 1; i < n; i++) {
+        for(i32 k = 0; k < 2; k++) {
+            value[k] += delta[k];
+            delta[k] += delta2[k];
+            delta2[k] += delta3[k];
+        }
+
+        points[i] = (SoftPoint) { value[0], value[1] };
+    }
+
+    // The last point is taken as is, so the rounding errors of the differences never move the end of the curve.
+    points[n] = control[degree];
+
+    return n + 1;
+}
+
+internal void softDrawBezier(const iVec2* control, i32 degree, Pixel pixel) {
+    // The curve lies inside of the convex hull of its control points.
+    if(softCameraCullsPoints(control, degree + 1, 0)) {
+        return;
+    }
+
+    // The control points are transformed without rounding, and the tolerance applies to the screen-space curve.
+    SoftPoint view[4];
+    SoftArenaMark mark = softFrameMark();
+    SoftPoint* points = (SoftPoint*)softFrameAlloc((SOFT_CURVE_SEGMENTS_MAX + 1) * sizeof(SoftPoint));
+
+    if(!points) {
+        return;
+    }
+
+    for(i32 i = 0; i <= degree; i++) {
+        view[i] = softViewPoint(control[i].x, control[i].y);
+    }
+
+    i32 count = softFlattenBezier(view, degree, points);
+
+    SoftPolyline polyline = { 0 };
+    softPolylineBegin(&polyline, (iVec2) { (i32)(floor(points[0].x + 0.5)), (i32)(floor(points[0].y + 0.5)) }, pixel);
+
+    for(i32 i = 1; i < count; i++) {
+        softPolylineTo(&polyline, (iVec2) { (i32)(floor(points[i].x + 0.5)), (i32)(floor(points[i].y + 0.5)) });
+    }
+
+    softFrameRelease(mark);
+}
+
+// ------------------------------
+// Strokes.
+// A stroke is filled, not stamped: every segment becomes a quad, every join and cap a small convex piece, and all of them
+// go into one path as positive contours. The nonzero rule then fills their union span by span, so the overlapping pieces
+// never blend a pixel twice. The stroked points are pixel centers, which centers a stroke on its one pixel wide line.
+// ------------------------------
+
+internal i32 softCircleSegments(d32 radius) {
+    // Chord count that keeps the polygon within SOFT_CURVE_TOLERANCE of the circle.
+    if(radius <= SOFT_CURVE_TOLERANCE) {
+        return 4;
+    }
+
+    d32 angle = 2.0 * acos(1.0 - SOFT_CURVE_TOLERANCE / radius);
+
+    return (i32)(SOFT_CLAMP(ceil(2.0 * PI / angle), 4.0, (d32)(SOFT_CURVE_SEGMENTS_MAX)));
+}
+
+internal void softPathAddCircle(SoftPath* path, SoftPoint center, d32 radius, i32 orientation) {
+    i32 count = softCircleSegments(radius);
+
+    // The edges are reserved before the points are taken from the frame arena: growing them afterwards would
+    // move them above the mark released here.
+    if(!softPathReserve(path, count)) {
+        return;
+    }
+
+    SoftArenaMark mark = softFrameMark();
+    SoftPoint* points = (SoftPoint*)softFrameAlloc(count * sizeof(SoftPoint));
+
+    if(!points) {
+        path->valid = false;
+        return;
+    }
+
+    for(i32 i = 0; i < count; i++) {
+        d32 angle = 2.0 * PI * i / count;
+
+        points[i] = (SoftPoint) { center.x + radius * cos(angle), center.y + radius * sin(angle) };
+    }
+
+    softPathAddContour(path, points, count, orientation);
+    softFrameRelease(mark);
+}
+
+internal SoftPoint softStrokeDirection(SoftPoint a, SoftPoint b) {
+    d32 length = hypot(b.x - a.x, b.y - a.y);
+
+    return (SoftPoint) { (b.x - a.x) / length, (b.y - a.y) / length };
+}
+
+internal void softPathAddJoin(SoftPath* path, SoftPoint p, SoftPoint d0, SoftPoint d1, d32 half) {
+    // [d0]: direction of the segment ending at [p], [d1]: direction of the one starting there.
+    if(CORE.Config.line_join == JOIN_ROUND) {
+        softPathAddCircle(path, p, half, 1);
+        return;
+    }
+
+    d32 cross = d0.x * d1.y - d0.y * d1.x;
+    d32 dot = d0.x * d1.x + d0.y * d1.y;
+
+    // The gap between the two quads opens on the outer side of the turn.
+    d32 side = cross > 0.0 ? -half : half;
+    SoftPoint o0 = { -d0.y * side, d0.x * side };
+    SoftPoint o1 = { -d1.y * side, d1.x * side };
+
+    // The miter tip is 1 / cos(angle / 2) = sqrt(2 / (1 + dot)) half widths away; sharper turns fall back to a bevel.
+    if(CORE.Config.line_join == JOIN_MITER && 1.0 + dot > 2.0 / (SOFT_STROKE_MITER_LIMIT * SOFT_STROKE_MITER_LIMIT)) {
+        d32 scale = 1.0 / (1.0 + dot);
+        SoftPoint miter[4] = { 
+            p, 
+            { p.x + o0.x, p.y + o0.y }, 
+            { p.x + (o0.x + o1.x) * scale, p.y + (o0.y + o1.y) * scale }, 
+            { p.x + o1.x, p.y + o1.y } 
+        };
+
+        softPathAddContour(path, miter, 4, 1);
+        return;
+    }
+
+    SoftPoint bevel[3] = { p, { p.x + o0.x, p.y + o0.y }, { p.x + o1.x, p.y + o1.y } };
+    softPathAddContour(path, bevel, 3, 1);
+}
+
+internal void softPathAddStroke(SoftPath* path, const SoftPoint* points, i32 count, bool closed, d32 width) {
+    d32 half = width / 2.0;
+
+    if(!path->valid || count < 1 || !(half > 0.0)) {
+        return;
+    }
+
+    // Repeated points have no direction, so they're dropped first (the copy is released with the path).
+    SoftPoint* unique = (SoftPoint*)softFrameAlloc(count * sizeof(SoftPoint));
+
+    if(!unique) {
+        path->valid = false;
+        return;
+    }
+
+    i32 n = 0;
+
+    for(i32 i = 0; i < count; i++) {
+        if(n == 0 || unique[n - 1].x != points[i].x || unique[n - 1].y != points[i].y) {
+            unique[n++] = points[i];
+        }
+    }
+
+    if(closed && n > 1 && unique[0].x == unique[n - 1].x && unique[0].y == unique[n - 1].y) {
+        n--;
+    }
+
+    closed = closed && n >= 3;
+    SoftLineCap cap = closed ? CAP_BUTT : CORE.Config.line_cap;
+
+    // A single point only shows its caps.
+    if(n == 1) {
+        if(cap == CAP_ROUND) {
+            softPathAddCircle(path, unique[0], half, 1);
+        } else if(cap == CAP_SQUARE) {
+            SoftPoint p = unique[0];
+            SoftPoint square[4] = { { p.x - half, p.y - half }, { p.x + half, p.y - half }, { p.x + half, p.y + half }, { p.x - half, p.y + half } };
+
+            softPathAddContour(path, square, 4, 1);
+        }
+
+        return;
+    }
+
+    i32 segments = closed ? n : n - 1;
+
+    for(i32 i = 0; i < segments; i++) {
+        SoftPoint a = unique[i];
+        SoftPoint b = unique[(i + 1) % n];
+        SoftPoint d = softStrokeDirection(a, b);
+
+        // Square caps extend the end segments by half of the width.
+        if(cap == CAP_SQUARE && i == 0) {
+            a = (SoftPoint) { a.x - d.x * half, a.y - d.y * half };
+        }
+
+        if(cap == CAP_SQUARE && i == segments - 1) {
+            b = (SoftPoint) { b.x + d.x * half, b.y + d.y * half };
+        }
+
+        SoftPoint normal = { -d.y * half, d.x * half };
+        SoftPoint quad[4] = { 
+            { a.x + normal.x, a.y + normal.y }, 
+            { b.x + normal.x, b.y + normal.y }, 
+            { b.x - normal.x, b.y - normal.y }, 
+            { a.x - normal.x, a.y - normal.y } 
+        };
+
+        softPathAddContour(path, quad, 4, 1);
+    }
+
+    for(i32 i = closed ? 0 : 1; i < (closed ? n : n - 1); i++) {
+        SoftPoint p = unique[i];
+
+        softPathAddJoin(path, p, softStrokeDirection(unique[(i + n - 1) % n], p), softStrokeDirection(p, unique[(i + 1) % n]), half);
+    }
+
+    if(cap == CAP_ROUND) {
+        softPathAddCircle(path, unique[0], half, 1);
+        softPathAddCircle(path, unique[n - 1], half, 1);
+    }
+}
+
+internal void softStrokePoints(const iVec2* points, i32 count, bool closed, f32 width, Pixel pixel) {
+    if(!points || count < 1 || !softGetFillKernel(pixel) || softCameraCullsPoints(points, count, (i32)(ceilf(width)))) {
+        return;
+    }
+
+    SoftArenaMark mark = softFrameMark();
+    SoftPoint* view = (SoftPoint*)softFrameAlloc(count * sizeof(SoftPoint));
+
+    if(!view) {
+        return;
+    }
+
+    for(i32 i = 0; i < count; i++) {
+        view[i] = softViewPoint(points[i].x + 0.5, points[i].y + 0.5);
+    }
+
+    SoftPath path = { 0 };
+    softPathBegin(&path, count * 8);
+    softPathAddStroke(&path, view, count, closed, softViewLength(width));
+    softPathFill(&path, FILL_NONZERO, pixel);
+
+    softFrameRelease(mark);
+}
+
+internal void softStrokeBezier(const iVec2* control, i32 degree, f32 width, Pixel pixel) {
+    if(!softGetFillKernel(pixel) || softCameraCullsPoints(control, degree + 1, (i32)(ceilf(width)))) {
+        return;
+    }
+
+    SoftPoint view[4];
+    SoftArenaMark mark = softFrameMark();
+    SoftPoint* points = (SoftPoint*)softFrameAlloc((SOFT_CURVE_SEGMENTS_MAX + 1) * sizeof(SoftPoint));
+
+    if(!points) {
+        return;
+    }
+
+    for(i32 i = 0; i <= degree; i++) {
+        view[i] = softViewPoint(control[i].x + 0.5, control[i].y + 0.5);
+    }
+
+    i32 count = softFlattenBezier(view, degree, points);
+
+    SoftPath path = { 0 };
+    softPathBegin(&path, count * 8);
+    softPathAddStroke(&path, points, count, false, softViewLength(width));
+    softPathFill(&path, FILL_NONZERO, pixel);
+
+    softFrameRelease(mark);
+}
+
+// ------------------------------
+// Text.
+// Fonts are rasterized once into an A8 coverage atlas. Drawing a string only blits the glyph rectangles out of it,
+// blending the tint through the coverage brush (like the anti-aliased primitives) and skipping the empty runs of every row.
+// The default font is the public domain font8x8_basic; it's baked lazily at every integer scale it gets drawn with.
+// softLoadFont bakes bitmap font sheets the same way, scaled by whole steps.
+// ------------------------------
+
+internal const u8 soft_font_default[SOFT_FONT_GLYPH_COUNT][SOFT_FONT_DEFAULT_SIZE] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ' '
+    { 0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00 },   // '!'
+    { 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '"'
+    { 0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00 },   // '#'
+    { 0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00 },   // '$'
+    { 0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00 },   // '%'
+    { 0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00 },   // '&'
+    { 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '''
+    { 0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00 },   // '('
+    { 0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00 },   // ')'
+    { 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00 },   // '*'
+    { 0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00 },   // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06 },   // ','
+    { 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00 },   // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00 },   // '.'
+    { 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 },   // '/'
+    { 0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00 },   // '0'
+    { 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00 },   // '1'
+    { 0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00 },   // '2'
+    { 0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00 },   // '3'
+    { 0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00 },   // '4'
+    { 0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00 },   // '5'
+    { 0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00 },   // '6'
+    { 0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00 },   // '7'
+    { 0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00 },   // '8'
+    { 0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00 },   // '9'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00 },   // ':'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06 },   // ';'
+    { 0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00 },   // '<'
+    { 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00 },   // '='
+    { 0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00 },   // '>'
+    { 0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00 },   // '?'
+    { 0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00 },   // '@'
+    { 0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00 },   // 'A'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00 },   // 'B'
+    { 0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00 },   // 'C'
+    { 0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00 },   // 'D'
+    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00 },   // 'E'
+    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00 },   // 'F'
+    { 0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00 },   // 'G'
+    { 0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00 },   // 'H'
+    { 0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },   // 'I'
+    { 0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00 },   // 'J'
+    { 0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00 },   // 'K'
+    { 0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00 },   // 'L'
+    { 0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00 },   // 'M'
+    { 0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00 },   // 'N'
+    { 0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00 },   // 'O'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00 },   // 'P'
+    { 0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00 },   // 'Q'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00 },   // 'R'
+    { 0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00 },   // 'S'
+    { 0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },   // 'T'
+    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00 },   // 'U'
+    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 },   // 'V'
+    { 0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00 },   // 'W'
+    { 0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00 },   // 'X'
+    { 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00 },   // 'Y'
+    { 0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00 },   // 'Z'
+    { 0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00 },   // '['
+    { 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00 },   // '\'
+    { 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00 },   // ']'
+    { 0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00 },   // '^'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF },   // '_'
+    { 0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '`'
+    { 0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00 },   // 'a'
+    { 0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00 },   // 'b'
+    { 0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00 },   // 'c'
+    { 0x38, 0x30, 0x30, 0x3E, 0x33, 0x33, 0x6E, 0x00 },   // 'd'
+    { 0x00, 0x00, 0x1E, 0x33, 0x3F, 0x03, 0x1E, 0x00 },   // 'e'
+    { 0x1C, 0x36, 0x06, 0x0F, 0x06, 0x06, 0x0F, 0x00 },   // 'f'
+    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F },   // 'g'
+    { 0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00 },   // 'h'
+    { 0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },   // 'i'
+    { 0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E },   // 'j'
+    { 0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00 },   // 'k'
+    { 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },   // 'l'
+    { 0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00 },   // 'm'
+    { 0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00 },   // 'n'
+    { 0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00 },   // 'o'
+    { 0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F },   // 'p'
+    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78 },   // 'q'
+    { 0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00 },   // 'r'
+    { 0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00 },   // 's'
+    { 0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00 },   // 't'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00 },   // 'u'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 },   // 'v'
+    { 0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00 },   // 'w'
+    { 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00 },   // 'x'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F },   // 'y'
+    { 0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00 },   // 'z'
+    { 0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00 },   // '{'
+    { 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },   // '|'
+    { 0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00 },   // '}'
+    { 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '~'
+};
+
+internal bool softPackFontAtlas(Font* font) {
+    // Shelf packing of the glyph sizes (already set in [font->glyphs]); allocates the cleared atlas.
+    i32 widest = 1;
+
+    for(i32 i = 0; i < SOFT_FONT_GLYPH_COUNT; i++) {
+        widest = SOFT_MAX(widest, font->glyphs[i].size.x);
+    }
+
+    i32 width = 16 * widest;
+    i32 x = 0, y = 0, shelf = 0;
+
+    for(i32 i = 0; i < SOFT_FONT_GLYPH_COUNT; i++) {
+        Glyph* glyph = &font->glyphs[i];
+
+        if(x + glyph->size.x > width) {
+            x = 0;
+            y += shelf;
+            shelf = 0;
+        }
+
+        glyph->position = (iVec2) { x, y };
+        x += glyph->size.x;
+        shelf = SOFT_MAX(shelf, glyph->size.y);
+    }
+
+    font->atlas_size = (iVec2) { width, SOFT_MAX(y + shelf, 1) };
+    font->atlas = (u8*)calloc(font->atlas_size.x * font->atlas_size.y, sizeof(u8));
+
+    if(!font->atlas) {
+        softLogError("softPackFontAtlas: %s", strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+internal Font* softGetDefaultFont(i32 size) {
+    i32 scale = SOFT_CLAMP(size / SOFT_FONT_DEFAULT_SIZE, 1, SOFT_FONT_DEFAULT_SCALE_MAX);
+    Font* font = &CORE.Text.default_fonts[scale - 1];
+
+    if(font->atlas) {
+        return font;
+    }
+
+    // The glyph rectangles are trimmed to their ink, so the blank rows and columns are never blitted.
+    for(i32 i = 0; i < SOFT_FONT_GLYPH_COUNT; i++) {
+        i32 column_min = SOFT_FONT_DEFAULT_SIZE, column_max = -1, row_min = SOFT_FONT_DEFAULT_SIZE, row_max = -1;
+
+        for(i32 row = 0; row < SOFT_FONT_DEFAULT_SIZE; row++) {
+            for(i32 column = 0; column < SOFT_FONT_DEFAULT_SIZE; column++) {
+                if(soft_font_default[i][row] >> column & 1) {
+                    column_min = SOFT_MIN(column_min, column);
+                    column_max = SOFT_MAX(column_max, column);
+                    row_min = SOFT_MIN(row_min, row);
+                    row_max = SOFT_MAX(row_max, row);
+                }
+            }
+        }
+
+        Glyph* glyph = &font->glyphs[i];
+        glyph->advance = SOFT_FONT_DEFAULT_SIZE * scale;
+
+        if(column_max >= 0) {
+            glyph->offset = (iVec2) { column_min * scale, row_min * scale };
+            glyph->size = (iVec2) { (column_max - column_min + 1) * scale, (row_max - row_min + 1) * scale };
+        }
+    }
+
+    if(!softPackFontAtlas(font)) {
+        return NULL;
+    }
+
+    for(i32 i = 0; i < SOFT_FONT_GLYPH_COUNT; i++) {
+        const Glyph* glyph = &font->glyphs[i];
+
+        for(i32 y = 0; y < glyph->size.y; y++) {
+            u8 bits = soft_font_default[i][(glyph->offset.y + y) / scale];
+            u8* dst = &font->atlas[(glyph->position.y + y) * font->atlas_size.x + glyph->position.x];
+
+            for(i32 x = 0; x < glyph->size.x; x++) {
+                dst[x] = (bits >> ((glyph->offset.x + x) / scale) & 1) ? 255 : 0;
+            }
+        }
+    }
+
+    font->line_height = (SOFT_FONT_DEFAULT_SIZE + 2) * scale;
+
+    return font;
+}
+
+internal void softDrawGlyph(const Font* font, const Glyph* glyph, i32 x, i32 y, SoftBounds clip, const SoftCoverageBrush* brush) {
+    i32 x0 = SOFT_MAX(x + glyph->offset.x, clip.x0);
+    i32 y0 = SOFT_MAX(y + glyph->offset.y, clip.y0);
+    i32 x1 = SOFT_MIN(x + glyph->offset.x + glyph->size.x, clip.x1);
+    i32 y1 = SOFT_MIN(y + glyph->offset.y + glyph->size.y, clip.y1);
+
+    for(i32 row = y0; row < y1; row++) {
+        const u8* coverage = &font->atlas[(glyph->position.y + row - y - glyph->offset.y) * font->atlas_size.x + glyph->position.x];
+        Pixel* dst = &CORE.PixelBuffer.pixel_buffer[row * CORE.PixelBuffer.size.x];
+        i32 shift = x + glyph->offset.x;
+
+        // Only the inked runs are blended.
+        for(i32 column = x0; column < x1;) {
+            for(; column < x1 && coverage[column - shift] == 0; column++);
+
+            i32 start = column;
+            for(; column < x1 && coverage[column - shift] != 0 && column - start < SOFT_SPAN_CHUNK_SIZE; column++);
+
+            if(column > start) {
+                softCoverageSpan(dst + start, coverage + start - shift, column - start, brush);
+            }
+        }
+    }
+}
+
+internal void softUnloadDefaultFonts(void) {
+    for(i32 i = 0; i < SOFT_FONT_DEFAULT_SCALE_MAX; i++) {
+        free(CORE.Text.default_fonts[i].atlas);
+        CORE.Text.default_fonts[i] = (Font) { 0 };
+    }
+}
+
+// ------------------------------
+// Image runs.
+// Sprites are mostly fully transparent or fully opaque pixels. The run encoding splits every row into skip (alpha 0),
+// opaque (alpha 255) and blend runs, so the blitter can jump over the transparent ones and copy the opaque ones.
+// Layout of [image->runs]: the offsets of the rows (height + 1 entries, relative to the end of the offset table), then the runs.
+// The runs describe the pixels at encoding time: images edited afterwards have to be encoded again (see: softEncodeImageRuns).
+// ------------------------------
+
+internal inline SoftRunType softClassifyRunPixel(Pixel pixel) {
+    u32 a = pixel >> 24;
+
+    return a == 0 ? SOFT_RUN_SKIP : a == 255 ? SOFT_RUN_OPAQUE : SOFT_RUN_BLEND;
+}
+
+internal i32 softEncodeRowRuns(const Pixel* row, i32 width, u32* runs) {
+    // Skip and opaque runs shorter than SOFT_RUN_LENGTH_MIN are blended instead (any pixel can go through the kernel),
+    // so noisy rows don't turn into a long list of tiny runs. Returns the run count.
+    i32 count = 0;
+
+    for(i32 x = 0; x < width;) {
+        SoftRunType type = softClassifyRunPixel(row[x]);
+        i32 start = x;
+
+        for(; x < width && softClassifyRunPixel(row[x]) == type; x++);
+
+        if(type != SOFT_RUN_BLEND && x - start < SOFT_RUN_LENGTH_MIN) {
+            type = SOFT_RUN_BLEND;
+        }
+
+        if(count > 0 && (SoftRunType)(runs[count - 1] >> SOFT_RUN_SHIFT) == type) {
+            runs[count - 1] += x - start;
+        } else {
+            runs[count++] = ((u32)(type) << SOFT_RUN_SHIFT) | (u32)(x - start);
+        }
+    }
+
+    return count;
+}
+
+internal u32* softBuildImageRuns(const Image* image) {
+    // Counts the runs first, so the encoding is a single allocation.
+    // Images without any skip or opaque run have nothing to gain, and stay unencoded (NULL).
+    // The scratch row is malloc'd rather than taken from the frame arena: the loader workers build runs too.
+    u32* scratch = (u32*)malloc(image->size.x * sizeof(u32));
+
+    if(!scratch) {
+        softLogError("softEncodeImageRuns: %s", strerror(errno));
+        return NULL;
+    }
+
+    u64 run_count = 0;
+    bool useful = false;
+
+    for(i32 y = 0; y < image->size.y; y++) {
+        i32 count = softEncodeRowRuns(&image->data[y * image->size.x], image->size.x, scratch);
+
+        useful = useful || count > 1 || (SoftRunType)(scratch[0] >> SOFT_RUN_SHIFT) != SOFT_RUN_BLEND;
+        run_count += count;
+    }
+
+    free(scratch);
+
+    if(!useful) {
+        return NULL;
+    }
+
+    u32* runs = (u32*)malloc((image->size.y + 1 + run_count) * sizeof(u32));
+
+    if(!runs) {
+        softLogError("softEncodeImageRuns: %s", strerror(errno));
+        return NULL;
+    }
+
+    u32* entries = runs + image->size.y + 1;
+    u32 offset = 0;
+
+    for(i32 y = 0; y < image->size.y; y++) {
+        runs[y] = offset;
+        offset += softEncodeRowRuns(&image->data[y * image->size.x], image->size.x, entries + offset);
+    }
+
+    runs[image->size.y] = offset;
+
+    return runs;
+}
+
+internal void softCopyImageSpan(Pixel* dst, const Pixel* src, i32 count, Pixel tint, bool tinted, SoftCopyKernel copy) {
+    if(!tinted) {
+        copy(dst, src, count);
+        return;
+    }
+
+    Pixel row[SOFT_SPAN_CHUNK_SIZE];
+
+    for(i32 i = 0; i < count; i += SOFT_SPAN_CHUNK_SIZE) {
+        i32 chunk = SOFT_MIN(SOFT_SPAN_CHUNK_SIZE, count - i);
+
+        softTintSpan(row, src + i, chunk, tint);
+        copy(dst + i, row, chunk);
+    }
+}
+
+internal void softDrawImageRuns(const Image* image, iVec2 origin, i32 x0, i32 y0, i32 x1, i32 y1, bool flip_v, Pixel tint) {
+    // Skip runs are left alone in every mode where a transparent pixel changes nothing; opaque runs are plain copies
+    // where an opaque pixel replaces the destination (and the tint doesn't change the pixels). The rest goes through the kernel.
+    SoftBlendMode mode = CORE.Config.blend_mode;
+    SoftCopyKernel copy = softGetCopyKernel();
+    bool tinted = !softPixelCompare(tint, WHITE);
+    bool skip = mode != BLEND_REPLACE && mode != BLEND_ALPHA_PREMULTIPLIED && mode != BLEND_COLOR_KEY;
+    bool replace = (mode == BLEND_ALPHA || mode == BLEND_ALPHA_PREMULTIPLIED || mode == BLEND_COLOR_KEY) && !tinted;
+
+    const u32* entries = image->runs + image->size.y + 1;
+    i32 column_first = x0 - origin.x;
+    i32 column_last = x1 - origin.x;
+
+    for(i32 y = y0; y < y1; y++) {
+        i32 src_y = flip_v ? image->size.y - 1 - (y - origin.y) : y - origin.y;
+
+        const Pixel* src = &image->data[src_y * image->size.x];
+        Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + origin.x];
+
+        const u32* run = entries + image->runs[src_y];
+        const u32* run_end = entries + image->runs[src_y + 1];
+
+        for(i32 column = 0; run < run_end && column < column_last; run++) {
+            i32 start = SOFT_MAX(column, column_first);
+            column += *run & SOFT_RUN_LENGTH_MASK;
+
+            i32 end = SOFT_MIN(column, column_last);
+            SoftRunType type = (SoftRunType)(*run >> SOFT_RUN_SHIFT);
+
+            if(start >= end || (type == SOFT_RUN_SKIP && skip)) {
+                continue;
+            }
+
+            if(type == SOFT_RUN_OPAQUE && replace) {
+                memcpy(dst + start, src + start, (end - start) * sizeof(Pixel));
+
+                if(CORE.Debug.view) {
+                    softCountWrites(dst + start, end - start, false);
+                }
+            } else {
+                softCopyImageSpan(dst + start, src + start, end - start, tint, tinted, copy);
+            }
+        }
+    }
+}
+
+// ------------------------------
+// Atlas packing.
+// Skyline bottom-left packer: every page keeps the top outline of its packed area as a list of horizontal segments,
+// and an image goes where its top edge ends up lowest (ties go to the narrowest segment, which wastes less space).
+// Images are packed from the tallest down, which keeps the skyline flat.
+// ------------------------------
+
+internal bool softSkylineFind(const SoftSkyline* skyline, iVec2 page_size, iVec2 size, i32* best_index, i32* best_y, i32* best_width) {
+    bool found = false;
+
+    for(i32 i = 0; i < skyline->count; i++) {
+        i32 x = skyline->nodes[i].x;
+
+        if(x + size.x > page_size.x) {
+            break;
+        }
+
+        // The image rests on the highest segment below it.
+        i32 y = 0;
+
+        for(i32 j = i; j < skyline->count && skyline->nodes[j].x < x + size.x; j++) {
+            y = SOFT_MAX(y, skyline->nodes[j].y);
+        }
+
+        if(y + size.y > page_size.y) {
+            continue;
+        }
+
+        if(!found || y < *best_y || (y == *best_y && skyline->nodes[i].width < *best_width)) {
+            *best_index = i;
+            *best_y = y;
+            *best_width = skyline->nodes[i].width;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+internal void softSkylineInsert(SoftSkyline* skyline, i32 index, i32 y, iVec2 size) {
+    SoftSkylineNode* nodes = skyline->nodes;
+    SoftSkylineNode node = { nodes[index].x, y + size.y, size.x };
+
+    memmove(&nodes[index + 1], &nodes[index], (skyline->count - index) * sizeof(SoftSkylineNode));
+    nodes[index] = node;
+    skyline->count++;
+
+    // The segments now under the image are cut back or removed.
+    for(i32 i = index + 1; i < skyline->count; i++) {
+        i32 overlap = node.x + node.width - nodes[i].x;
+
+        if(overlap <= 0) {
+            break;
+        }
+
+        if(overlap < nodes[i].width) {
+            nodes[i].x += overlap;
+            nodes[i].width -= overlap;
+            break;
+        }
+
+        memmove(&nodes[i], &nodes[i + 1], (skyline->count - i - 1) * sizeof(SoftSkylineNode));
+        skyline->count--;
+        i--;
+    }
+
+    // Neighbours at the same height are merged.
+    for(i32 i = 0; i + 1 < skyline->count; i++) {
+        if(nodes[i].y == nodes[i + 1].y) {
+            nodes[i].width += nodes[i + 1].width;
+            memmove(&nodes[i + 1], &nodes[i + 2], (skyline->count - i - 2) * sizeof(SoftSkylineNode));
+            skyline->count--;
+            i--;
+        }
+    }
+
+    skyline->height = SOFT_MAX(skyline->height, y + size.y);
+}
+
+internal const Image* soft_atlas_sort_images = NULL;
+
+internal i32 softCompareAtlasImages(const void* a, const void* b) {
+    // Taller first, then wider; the index keeps the order stable.
+    const Image* image_a = &soft_atlas_sort_images[*(const i32*)(a)];
+    const Image* image_b = &soft_atlas_sort_images[*(const i32*)(b)];
+
+    if(image_a->size.y != image_b->size.y) {
+        return image_b->size.y - image_a->size.y;
+    }
+
+    if(image_a->size.x != image_b->size.x) {
+        return image_b->size.x - image_a->size.x;
+    }
+
+    return *(const i32*)(a) - *(const i32*)(b);
+}
+
+// ------------------------------
+// Deferred drawing.
+// Between softBeginDeferred and softEndDeferred clears, rectangles, images and text are queued instead of drawn.
+// The flush walks the queue front to back (newest first) over a coarse mask of SOFT_DEFERRED_TILE_SIZE tiles:
+// a primitive only keeps the part of every tile row that isn't covered yet, and opaque primitives then cover
+// the tiles they fill completely. The queue is drawn in submission order, every primitive clipped to its visible bands,
+// so the result is the same as drawing right away. Anything else drawn meanwhile flushes the queue first.
+// ------------------------------
+
+internal bool softPixelOccludes(Pixel pixel) {
+    // In these modes an opaque pixel replaces the destination (in BLEND_REPLACE every pixel does, in BLEND_COLOR_KEY every one but BLANK).
+    SoftBlendMode mode = CORE.Config.blend_mode;
+
+    return mode == BLEND_REPLACE || (mode == BLEND_COLOR_KEY && pixel != BLANK) ||
+        ((mode == BLEND_ALPHA || mode == BLEND_ALPHA_PREMULTIPLIED) && pixel >> 24 == 0xFF);
+}
+
+internal bool softImageOccludes(const Image* image, i32 y0, i32 y1, Pixel tint) {
+    // Rows [y0, y1) of the image replace what's below them; the runs tell whether a row is opaque all the way.
+    if(CORE.Config.blend_mode == BLEND_REPLACE) {
+        return true;
+    }
+
+    // An opaque tint keeps opaque texels opaque (and never BLANK).
+    if(tint >> 24 != 0xFF || !softPixelOccludes(tint) || !image->runs || y0 < 0 || y1 > image->size.y) {
+        return false;
+    }
+
+    const u32* entries = image->runs + image->size.y + 1;
+
+    for(i32 y = y0; y < y1; y++) {
+        if(image->runs[y + 1] - image->runs[y] != 1 || (SoftRunType)(entries[image->runs[y]] >> SOFT_RUN_SHIFT) != SOFT_RUN_OPAQUE) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+internal void softFlushDeferred(void);
+
+internal bool softDeferring(void) {
+    return CORE.Deferred.active && !CORE.Deferred.replaying;
+}
+
+internal SoftDrawCommand* softDeferCommand(SoftCommandType type, SoftBounds area, bool world, bool opaque, Pixel pixel) {
+    // Queues a primitive covering [area] (world space when [world] and the camera is on) while the deferred mode is active.
+    // NULL: the primitive is drawn right away.
+    if(!softDeferring()) {
+        return NULL;
+    }
+
+    if(CORE.Deferred.count == CORE.Deferred.capacity) {
+        i32 capacity = SOFT_MAX(CORE.Deferred.capacity * 2, 64);
+        SoftDrawCommand* commands = (SoftDrawCommand*)realloc(CORE.Deferred.commands, capacity * sizeof(SoftDrawCommand));
+
+        if(!commands) {
+            softLogError("softDeferCommand: %s", strerror(errno));
+            softFlushDeferred();
+            return NULL;
+        }
+
+        CORE.Deferred.commands = commands;
+        CORE.Deferred.capacity = capacity;
+    }
+
+    if(world && CORE.Camera.active) {
+        if(CORE.Camera.translation_only) {
+            area = (SoftBounds) { area.x0 + CORE.Camera.translation.x, area.y0 + CORE.Camera.translation.y, area.x1 + CORE.Camera.translation.x, area.y1 + CORE.Camera.translation.y };
+        } else {
+            // Transformed views: the bounding box of the mapped corners, with a margin for the rounding.
+            const iVec2 corners[4] = { { area.x0, area.y0 }, { area.x1, area.y0 }, { area.x0, area.y1 }, { area.x1, area.y1 } };
+            SoftBounds mapped = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+
+            for(i32 i = 0; i < 4; i++) {
+                iVec2 point = softCameraPoint(corners[i]);
+
+                mapped = (SoftBounds) { SOFT_MIN(mapped.x0, point.x), SOFT_MIN(mapped.y0, point.y), SOFT_MAX(mapped.x1, point.x), SOFT_MAX(mapped.y1, point.y) };
+            }
+
+            area = (SoftBounds) { mapped.x0 - 2, mapped.y0 - 2, mapped.x1 + 2, mapped.y1 + 2 };
+            opaque = false;
+        }
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    SoftDrawCommand* command = &CORE.Deferred.commands[CORE.Deferred.count++];
+
+    *command = (SoftDrawCommand) {
+        .type = type,
+        .blend_mode = CORE.Config.blend_mode,
+        .image_filter = CORE.Config.image_filter,
+        .camera_active = CORE.Camera.active,
+        .camera = CORE.Camera.camera,
+        .bounds = { SOFT_MAX(area.x0, clip.x0), SOFT_MAX(area.y0, clip.y0), SOFT_MIN(area.x1, clip.x1), SOFT_MIN(area.y1, clip.y1) },
+        .opaque = opaque,
+        .pixel = pixel
+    };
+
+    return command;
+}
+
+internal void softReplayCommand(SoftDrawCommand* command) {
+    switch(command->type) {
+        case SOFT_COMMAND_CLEAR:
+            softClearBufferColor(command->pixel);
+            break;
+
+        case SOFT_COMMAND_RECTANGLE:
+            softDrawRectangle(command->rect, command->pixel);
+            break;
+
+        case SOFT_COMMAND_IMAGE:
+            softDrawImageEx(&command->image.image, command->image.dest.position, command->image.pivot, command->image.flip, command->pixel);
+            break;
+
+        case SOFT_COMMAND_IMAGE_PRO:
+            softDrawImagePro(&command->image.image, command->image.source, command->image.dest, command->pixel);
+            break;
+
+        case SOFT_COMMAND_IMAGE_REC:
+            softDrawImageRec(&command->image.image, command->image.source, command->image.dest.position, command->pixel);
+            break;
+
+        case SOFT_COMMAND_TEXT:
+            softDrawTextEx(command->text.font, (const string)(command->text.text), command->text.position, command->pixel);
+            break;
+    }
+}
+
+internal void softFlushDeferred(void) {
+    // Draws the queue (when there's one). Called before anything that isn't queued touches the pixel buffer.
+    if(CORE.Deferred.count == 0 || CORE.Deferred.replaying) {
+        return;
+    }
+
+    const i32 tile = SOFT_DEFERRED_TILE_SIZE;
+    i32 tiles_x = (CORE.PixelBuffer.size.x + tile - 1) / tile;
+    i32 tiles_y = (CORE.PixelBuffer.size.y + tile - 1) / tile;
+    i32 count = CORE.Deferred.count;
+
+    // Every primitive gets at most one band per tile row.
+    i32 band_capacity = 0;
+
+    for(i32 i = 0; i < count; i++) {
+        SoftBounds bounds = CORE.Deferred.commands[i].bounds;
+
+        if(!softClipBoundsEmpty(bounds)) {
+            band_capacity += (bounds.y1 - 1) / tile - bounds.y0 / tile + 1;
+        }
+    }
+
+    SoftArenaMark mark = softFrameMark();
+    u8* covered = (u8*)softFrameAlloc((size_t)(tiles_x) * tiles_y);
+    SoftBounds* bands = (SoftBounds*)softFrameAlloc(band_capacity * sizeof(SoftBounds) + sizeof(SoftBounds));
+    i32* band_first = (i32*)softFrameAlloc((count + 1) * sizeof(i32));
+
+    if(!covered || !bands || !band_first) {
+        // No memory for the mask: every primitive is drawn whole.
+        softLogWarning("softFlushDeferred: Drawing the queue without occlusion culling...");
+        bands = NULL;
+    }
+
+    // Front to back: the bands are stored from the end of the array, so they come out in submission order.
+    i32 band_count = band_capacity;
+
+    if(bands) {
+        memset(covered, 0, (size_t)(tiles_x) * tiles_y);
+        band_first[count] = band_capacity;
+    }
+
+    for(i32 i = count - 1; bands && i >= 0; i--) {
+        const SoftDrawCommand* command = &CORE.Deferred.commands[i];
+        SoftBounds bounds = command->bounds;
+
+        band_first[i] = band_count;
+
+        if(softClipBoundsEmpty(bounds)) {
+            continue;
+        }
+
+        i32 tx0 = bounds.x0 / tile;
+        i32 tx1 = (bounds.x1 - 1) / tile;
+        i32 first_band = band_count;
+
+        for(i32 ty = (bounds.y1 - 1) / tile; ty >= bounds.y0 / tile; ty--) {
+            const u8* row = &covered[ty * tiles_x];
+            i32 x0 = tx0, x1 = tx1;
+
+            for(; x0 <= tx1 && row[x0]; x0++);
+            for(; x1 >= x0 && row[x1]; x1--);
+
+            if(x0 > x1) {
+                continue;
+            }
+
+            SoftBounds band = { SOFT_MAX(bounds.x0, x0 * tile), SOFT_MAX(bounds.y0, ty * tile), SOFT_MIN(bounds.x1, (x1 + 1) * tile), SOFT_MIN(bounds.y1, (ty + 1) * tile) };
+
+            // Rows with the same columns are drawn together.
+            if(band_count < first_band && bands[band_count].x0 == band.x0 && bands[band_count].x1 == band.x1 && bands[band_count].y0 == band.y1) {
+                bands[band_count].y0 = band.y0;
+            } else {
+                bands[--band_count] = band;
+            }
+        }
+
+        band_first[i] = band_count;
+
+        if(!command->opaque) {
+            continue;
+        }
+
+        // Only whole tiles are covered (the ones cut by the edge of the buffer count as whole).
+        i32 cx0 = (bounds.x0 + tile - 1) / tile;
+        i32 cy0 = (bounds.y0 + tile - 1) / tile;
+        i32 cx1 = bounds.x1 >= CORE.PixelBuffer.size.x ? tiles_x : bounds.x1 / tile;
+        i32 cy1 = bounds.y1 >= CORE.PixelBuffer.size.y ? tiles_y : bounds.y1 / tile;
+
+        for(i32 ty = cy0; ty < cy1; ty++) {
+            for(i32 tx = cx0; tx < cx1; tx++) {
+                covered[ty * tiles_x + tx] = 1;
+            }
+        }
+    }
+
+    // Back to front, in the state every primitive was submitted with.
+    SoftBlendMode blend_mode = CORE.Config.blend_mode;
+    SoftImageFilter image_filter = CORE.Config.image_filter;
+    bool camera_active = CORE.Camera.active;
+    Camera2D camera = CORE.Camera.camera;
+    SoftBounds clip_base = CORE.Clip.stack[0];
+    i32 clip_count = CORE.Clip.count;
+
+    CORE.Deferred.replaying = true;
+
+    for(i32 i = 0; i < count; i++) {
+        SoftDrawCommand* command = &CORE.Deferred.commands[i];
+        const SoftBounds* visible = bands ? &bands[band_first[i]] : &command->bounds;
+        i32 visible_count = bands ? band_first[i + 1] - band_first[i] : !softClipBoundsEmpty(command->bounds);
+
+        if(visible_count == 0) {
+            continue;
+        }
+
+        CORE.Config.blend_mode = command->blend_mode;
+        CORE.Config.image_filter = command->image_filter;
+
+        if(command->camera_active) {
+            softBeginMode2D(command->camera);
+        } else {
+            CORE.Camera.active = false;
+        }
+
+        for(i32 band = 0; band < visible_count; band++) {
+            CORE.Clip.stack[0] = visible[band];
+            CORE.Clip.count = 1;
+            CORE.Camera.view_valid = false;
+
+            softReplayCommand(command);
+        }
+    }
+
+    CORE.Deferred.replaying = false;
+    CORE.Deferred.count = 0;
+
+    CORE.Config.blend_mode = blend_mode;
+    CORE.Config.image_filter = image_filter;
+    CORE.Clip.stack[0] = clip_base;
+    CORE.Clip.count = clip_count;
+
+    if(camera_active) {
+        softBeginMode2D(camera);
+    } else {
+        CORE.Camera.active = false;
+        CORE.Camera.view_valid = false;
+    }
+
+    softFrameRelease(mark);
+}
+
+// ------------------------------
+// Draw recording.
+// Every public draw call starts with SOFT_RECORD_CALL: while recording, it writes the call and its arguments, then makes the same call
+// one level deeper, so the draws it's built from aren't written a second time. A state record goes in front of every call the state changed for.
+// Images and fonts are written along with the first call that uses them; later calls only reference them by id.
+// ------------------------------
+
+#define SOFT_RECORD_VALUE(value) softRecordBytes(&(value), sizeof(value))
+#define SOFT_READ_VALUE(replay, value) softReadRecording(replay, &(value), sizeof(value))
+
+#define SOFT_RECORD_CALL(type, call, ...) \
+    if(CORE.Recording.file && CORE.Recording.depth == 0) { \
+        softRecordCall(type); \
+        __VA_ARGS__; \
+        CORE.Recording.depth++; \
+        call; \
+        CORE.Recording.depth--; \
+        return; \
+    }
+
+// The same, for a call with a result: [call] is made one level deeper and its result returned.
+#define SOFT_RECORD_CALL_RESULT(type, result_type, call, ...) \
+    if(CORE.Recording.file && CORE.Recording.depth == 0) { \
+        softRecordCall(type); \
+        __VA_ARGS__; \
+        CORE.Recording.depth++; \
+        result_type result = call; \
+        CORE.Recording.depth--; \
+        return result; \
+    }
+
+internal void softRecordBytes(const void* data, size_t size) {
+    if(CORE.Recording.failed || size == 0) {
+        return;
+    }
+
+    if(fwrite(data, 1, size, CORE.Recording.file) != size) {
+        softLogError("softBeginRecording: Recording could not be written: %s", strerror(errno));
+        CORE.Recording.failed = true;
+    }
+}
+
+internal SoftRecordState softGetRecordState(void) {
+    SoftRecordState state = { 0 };
+
+    state.blend_mode = CORE.Config.blend_mode;
+    state.image_filter = CORE.Config.image_filter;
+    state.fill_rule = CORE.Config.fill_rule;
+    state.line_join = CORE.Config.line_join;
+    state.line_cap = CORE.Config.line_cap;
+    state.image_runs = CORE.Config.image_runs;
+    state.camera_active = CORE.Camera.active;
+    state.deferred = CORE.Deferred.active;
+    state.clip = softGetClipBounds();
+
+    if(CORE.Camera.active) {
+        state.camera = CORE.Camera.camera;
+    }
+
+    return state;
+}
+
+internal void softSetRecordState(const SoftRecordState* state) {
+    // The queued draws are flushed with the state they were queued with.
+    if(!state->deferred && CORE.Deferred.active) {
+        softEndDeferred();
+    }
+
+    CORE.Config.blend_mode = state->blend_mode;
+    CORE.Config.image_filter = state->image_filter;
+    CORE.Config.fill_rule = state->fill_rule;
+    CORE.Config.line_join = state->line_join;
+    CORE.Config.line_cap = state->line_cap;
+    CORE.Config.image_runs = state->image_runs != 0;
+
+    CORE.Clip.stack[0] = state->clip;
+    CORE.Clip.count = 1;
+    CORE.Camera.view_valid = false;
+
+    if(state->camera_active) {
+        softBeginMode2D(state->camera);
+    } else {
+        softEndMode2D();
+    }
+
+    if(state->deferred && !CORE.Deferred.active) {
+        softBeginDeferred();
+    }
+}
+
+internal void softRecordCall(SoftCallType type) {
+    SoftRecordState state = softGetRecordState();
+
+    if(!CORE.Recording.state_valid || memcmp(&state, &CORE.Recording.state, sizeof(state)) != 0) {
+        u8 state_type = SOFT_CALL_STATE;
+
+        SOFT_RECORD_VALUE(state_type);
+        SOFT_RECORD_VALUE(state);
+
+        CORE.Recording.state = state;
+        CORE.Recording.state_valid = true;
+    }
+
+    u8 call_type = (u8)type;
+    SOFT_RECORD_VALUE(call_type);
+}
+
+internal void softRecordFrame(void) {
+    if(CORE.Recording.file && CORE.Recording.depth == 0) {
+        u8 type = SOFT_CALL_FRAME;
+
+        SOFT_RECORD_VALUE(type);
+        CORE.Recording.frame++;
+    }
+}
+
+internal u32 softHashPointer(const void* pointer) {
+    return (u32)(((uintptr_t)(pointer) >> 4) * 2654435761u);
+}
+
+internal SoftRecordedImage* softFindRecordedImage(const Pixel* data) {
+    // The entry of [data], or the free one it goes into. The table grows at half load, and entries are never removed.
+    if(CORE.Recording.image_used * 2 >= CORE.Recording.image_capacity) {
+        i32 capacity = SOFT_MAX(CORE.Recording.image_capacity * 2, 64);
+        SoftRecordedImage* images = (SoftRecordedImage*)calloc(capacity, sizeof(SoftRecordedImage));
+
+        if(!images) {
+            return NULL;
+        }
+
+        for(i32 i = 0; i < CORE.Recording.image_capacity; i++) {
+            if(CORE.Recording.images[i].data) {
+                u32 slot = softHashPointer(CORE.Recording.images[i].data) & (capacity - 1);
+
+                for(; images[slot].data; slot = (slot + 1) & (capacity - 1));
+                images[slot] = CORE.Recording.images[i];
+            }
+        }
+
+        free(CORE.Recording.images);
+        CORE.Recording.images = images;
+        CORE.Recording.image_capacity = capacity;
+    }
+
+    u32 mask = CORE.Recording.image_capacity - 1;
+    u32 slot = softHashPointer(data) & mask;
+
+    for(; CORE.Recording.images[slot].data && CORE.Recording.images[slot].data != data; slot = (slot + 1) & mask);
+
+    return &CORE.Recording.images[slot];
+}
+
+internal void softRecordImage(const Image* image) {
+    // The id of the image, preceded by its pixels when they're new: on its first use, or once the content under the pointer changed.
+    // The content is compared once per frame, so the image must not change between two draws of the same frame.
+    u32 id = 0;
+
+    if(image && image->data) {
+        SoftRecordedImage* entry = softFindRecordedImage(image->data);
+        size_t length = (size_t)(SOFT_MAX(image->size.x, 0)) * SOFT_MAX(image->size.y, 0) * sizeof(Pixel);
+
+        if(!entry) {
+            softLogError("softBeginRecording: %s", strerror(errno));
+            CORE.Recording.failed = true;
+            return;
+        }
+
+        bool known = entry->data && entry->size.x == image->size.x && entry->size.y == image->size.y &&
+            (entry->frame == CORE.Recording.frame || memcmp(entry->copy, image->data, length) == 0);
+
+        if(!known) {
+            Pixel* copy = (Pixel*)realloc(entry->copy, SOFT_MAX(length, sizeof(Pixel)));
+
+            if(!copy) {
+                softLogError("softBeginRecording: %s", strerror(errno));
+                CORE.Recording.failed = true;
+                return;
+            }
+
+            memcpy(copy, image->data, length);
+            CORE.Recording.image_used += entry->data == NULL;
+            *entry = (SoftRecordedImage) { image->data, image->size, copy, ++CORE.Recording.image_ids, CORE.Recording.frame };
+
+            u32 definition = entry->id | SOFT_RECORD_DEFINITION;
+            i32 runs = image->runs != NULL;
+
+            SOFT_RECORD_VALUE(definition);
+            SOFT_RECORD_VALUE(image->size);
+            SOFT_RECORD_VALUE(image->channels);
+            SOFT_RECORD_VALUE(runs);
+            softRecordBytes(image->data, length);
+            return;
+        }
+
+        entry->frame = CORE.Recording.frame;
+        id = entry->id;
+    }
+
+    SOFT_RECORD_VALUE(id);
+}
+
+internal void softRecordFont(const Font* font) {
+    // The default fonts are referenced by their scale; the others are written with their first use (they're not expected to change).
+    u32 id = 0;
+
+    for(i32 i = 0; font && i < SOFT_FONT_DEFAULT_SCALE_MAX; i++) {
+        if(font == &CORE.Text.default_fonts[i]) {
+            id = SOFT_RECORD_DEFAULT_FONT | (u32)(i);
+        }
+    }
+
+    for(i32 i = 0; font && id == 0 && i < CORE.Recording.font_count; i++) {
+        if(CORE.Recording.fonts[i].font == font && CORE.Recording.fonts[i].atlas == font->atlas) {
+            id = CORE.Recording.fonts[i].id;
+        }
+    }
+
+    if(font && id == 0) {
+        SoftRecordedFont* fonts = (SoftRecordedFont*)realloc(CORE.Recording.fonts, (CORE.Recording.font_count + 1) * sizeof(SoftRecordedFont));
+
+        if(!fonts) {
+            softLogError("softBeginRecording: %s", strerror(errno));
+            CORE.Recording.failed = true;
+            return;
+        }
+
+        CORE.Recording.fonts = fonts;
+        CORE.Recording.fonts[CORE.Recording.font_count] = (SoftRecordedFont) { font, font->atlas, (u32)(CORE.Recording.font_count + 1) };
+
+        u32 definition = (u32)(++CORE.Recording.font_count) | SOFT_RECORD_DEFINITION;
+
+        SOFT_RECORD_VALUE(definition);
+        SOFT_RECORD_VALUE(font->atlas_size);
+        SOFT_RECORD_VALUE(font->glyphs);
+        SOFT_RECORD_VALUE(font->line_height);
+        softRecordBytes(font->atlas, font->atlas ? (size_t)(font->atlas_size.x) * font->atlas_size.y : 0);
+        return;
+    }
+
+    SOFT_RECORD_VALUE(id);
+}
+
+internal void softRecordText(const char* text) {
+    // Written with its terminator, so the replay can use it in place.
+    u32 length = text ? (u32)(strlen(text)) + 1 : 0;
+
+    SOFT_RECORD_VALUE(length);
+    softRecordBytes(text, length);
+}
+
+internal void softRecordPoints(const iVec2* points, i32 count) {
+    count = points ? SOFT_MAX(count, 0) : 0;
+
+    SOFT_RECORD_VALUE(count);
+    softRecordBytes(points, count * sizeof(iVec2));
+}
+
+internal void softCloseRecording(void) {
+    for(i32 i = 0; i < CORE.Recording.image_capacity; i++) {
+        free(CORE.Recording.images[i].copy);
+    }
+
+    free(CORE.Recording.images);
+    free(CORE.Recording.fonts);
+    memset(&CORE.Recording, 0, sizeof(CORE.Recording));
+}
+
+internal bool softReadRecording(SoftReplay* replay, void* value, size_t size) {
+    if(replay->failed || size > replay->size - replay->offset) {
+        replay->failed = true;
+        return false;
+    }
+
+    if(size > 0) {
+        memcpy(value, replay->data + replay->offset, size);
+        replay->offset += size;
+    }
+
+    return true;
+}
+
+internal bool softReplayFits(SoftReplay* replay, iVec2 size, size_t element_size) {
+    // The data of a [size] grid of elements is within the rest of the recording (negative sizes never are).
+    return size.x >= 0 && size.y >= 0 && (u64)(size.x) * (u64)(size.y) <= (replay->size - replay->offset) / element_size;
+}
+
+internal bool softReplayState(SoftReplay* replay) {
+    SoftRecordState state;
+
+    if(!SOFT_READ_VALUE(replay, state)) {
+        return false;
+    }
+
+    if(state.blend_mode < BLEND_REPLACE || state.blend_mode >= BLEND_COUNT || state.image_filter < FILTER_NEAREST || state.image_filter > FILTER_BILINEAR ||
+        state.fill_rule < FILL_NONZERO || state.fill_rule > FILL_EVEN_ODD || state.line_join < JOIN_MITER || state.line_join > JOIN_BEVEL ||
+        state.line_cap < CAP_BUTT || state.line_cap > CAP_SQUARE) {
+        replay->failed = true;
+        return false;
+    }
+
+    softSetRecordState(&state);
+    return true;
+}
+
+internal bool softReplayImage(SoftReplay* replay, Image** image) {
+    u32 id;
+    *image = NULL;
+
+    if(!SOFT_READ_VALUE(replay, id)) {
+        return false;
+    }
+
+    if(!(id & SOFT_RECORD_DEFINITION)) {
+        if(id > (u32)(replay->image_count)) {
+            replay->failed = true;
+            return false;
+        }
+
+        *image = id ? &replay->images[id - 1] : NULL;
+        return true;
+    }
+
+    Image result = { 0 };
+    i32 runs;
+
+    if(!SOFT_READ_VALUE(replay, result.size) || !SOFT_READ_VALUE(replay, result.channels) || !SOFT_READ_VALUE(replay, runs)) {
+        return false;
+    }
+
+    size_t length = softReplayFits(replay, result.size, sizeof(Pixel)) ? (size_t)(result.size.x) * result.size.y * sizeof(Pixel) : 0;
+    Image* images = (id & ~SOFT_RECORD_DEFINITION) == (u32)(replay->image_count + 1) && softReplayFits(replay, result.size, sizeof(Pixel)) ?
+        (Image*)realloc(replay->images, (replay->image_count + 1) * sizeof(Image)) : NULL;
+
+    if(!images) {
+        replay->failed = true;
+        return false;
+    }
+
+    replay->images = images;
+    result.data = (PixelBuffer)malloc(SOFT_MAX(length, sizeof(Pixel)));
+
+    if(!result.data || !softReadRecording(replay, result.data, length)) {
+        free(result.data);
+        replay->failed = true;
+        return false;
+    }
+
+    result.runs = runs ? softBuildImageRuns(&result) : NULL;
+    replay->images[replay->image_count] = result;
+    *image = &replay->images[replay->image_count++];
+
+    return true;
+}
+
+internal bool softReplayFont(SoftReplay* replay, Font** font) {
+    u32 id;
+    *font = NULL;
+
+    if(!SOFT_READ_VALUE(replay, id)) {
+        return false;
+    }
+
+    if(id & SOFT_RECORD_DEFAULT_FONT) {
+        i32 scale = (i32)(id & ~SOFT_RECORD_DEFAULT_FONT) + 1;
+
+        if(scale > SOFT_FONT_DEFAULT_SCALE_MAX) {
+            replay->failed = true;
+            return false;
+        }
+
+        *font = softGetDefaultFont(scale * SOFT_FONT_DEFAULT_SIZE);
+        return true;
+    }
+
+    if(!(id & SOFT_RECORD_DEFINITION)) {
+        if(id > (u32)(replay->font_count)) {
+            replay->failed = true;
+            return false;
+        }
+
+        *font = id ? replay->fonts[id - 1] : NULL;
+        return true;
+    }
+
+    // Fonts are allocated one by one: queued text keeps pointing at them.
+    Font* result = (Font*)calloc(1, sizeof(Font));
+    Font** fonts = result && (id & ~SOFT_RECORD_DEFINITION) == (u32)(replay->font_count + 1) ?
+        (Font**)realloc(replay->fonts, (replay->font_count + 1) * sizeof(Font*)) : NULL;
+
+    if(!fonts) {
+        free(result);
+        replay->failed = true;
+        return false;
+    }
+
+    replay->fonts = fonts;
+
+    if(!SOFT_READ_VALUE(replay, result->atlas_size) || !SOFT_READ_VALUE(replay, result->glyphs) || !SOFT_READ_VALUE(replay, result->line_height)) {
+        free(result);
+        return false;
+    }
+
+    size_t length = softReplayFits(replay, result->atlas_size, 1) ? (size_t)(result->atlas_size.x) * result->atlas_size.y : 0;
+    result->atlas = softReplayFits(replay, result->atlas_size, 1) ? (u8*)malloc(SOFT_MAX(length, 1)) : NULL;
+
+    if(!result->atlas || !softReadRecording(replay, result->atlas, length)) {
+        free(result->atlas);
+        free(result);
+        replay->failed = true;
+        return false;
+    }
+
+    replay->fonts[replay->font_count++] = result;
+    *font = result;
+
+    return true;
+}
+
+internal bool softReplayText(SoftReplay* replay, string* text) {
+    u32 length;
+    *text = NULL;
+
+    if(!SOFT_READ_VALUE(replay, length)) {
+        return false;
+    }
+
+    if(length > replay->size - replay->offset || (length > 0 && replay->data[replay->offset + length - 1] != 0)) {
+        replay->failed = true;
+        return false;
+    }
+
+    *text = length ? (string)(replay->data + replay->offset) : NULL;
+    replay->offset += length;
+
+    return true;
+}
+
+internal bool softReplayPoints(SoftReplay* replay, iVec2** points, i32* count) {
+    // The points are copied to the frame arena: in the recording they're not aligned.
+    *points = NULL;
+
+    if(!SOFT_READ_VALUE(replay, *count)) {
+        return false;
+    }
+
+    if(*count < 0 || (size_t)(*count) * sizeof(iVec2) > replay->size - replay->offset) {
+        replay->failed = true;
+        return false;
+    }
+
+    if(*count > 0) {
+        *points = (iVec2*)softFrameAlloc(*count * sizeof(iVec2));
+
+        if(!*points) {
+            replay->failed = true;
+            return false;
+        }
+    }
+
+    return softReadRecording(replay, *points, *count * sizeof(iVec2));
+}
+
+// ------------------------------
+// Tilemaps.
+// Every tile is a region blit from an atlas page. Cached maps are split into chunks of about SOFT_TILEMAP_CHUNK_SIZE pixels:
+// a chunk is rendered into its own image when it's first visible (and again once one of its tiles changes),
+// then drawn as a single run-encoded image, so the empty cells cost nothing. Only the chunks or cells in view are touched.
+// ------------------------------
+
+internal bool softGetTileRegion(const Tilemap* tilemap, i32 tile, Rect* source, const Image** page) {
+    // The atlas region of [tile], limited to one cell.
+    if(tile < 0 || tile >= tilemap->atlas->region_count) {
+        return false;
+    }
+
+    AtlasRegion region = tilemap->atlas->regions[tile];
+
+    *page = &tilemap->atlas->pages[region.page];
+    *source = (Rect) { region.rect.position, { SOFT_MIN(region.rect.size.x, tilemap->tile_size.x), SOFT_MIN(region.rect.size.y, tilemap->tile_size.y) } };
+
+    return true;
+}
+
+internal SoftBounds softGetVisibleCells(iVec2 position, iVec2 cell_size, iVec2 count) {
+    // The cells of a [count] grid placed at [position] that overlap the clip area (the camera's view in 2D mode).
+    SoftBounds view = CORE.Camera.active ? softCameraView() : softGetClipBounds();
+
+    if(softClipBoundsEmpty(view)) {
+        return (SoftBounds) { 0 };
+    }
+
+    return (SoftBounds) {
+        (i32)(SOFT_MAX(softFloorDiv((i64)(view.x0) - position.x, cell_size.x), 0)),
+        (i32)(SOFT_MAX(softFloorDiv((i64)(view.y0) - position.y, cell_size.y), 0)),
+        (i32)(SOFT_MIN(softFloorDiv((i64)(view.x1) - 1 - position.x, cell_size.x) + 1, count.x)),
+        (i32)(SOFT_MIN(softFloorDiv((i64)(view.y1) - 1 - position.y, cell_size.y) + 1, count.y))
+    };
+}
+
+internal void softDrawTile(const Tilemap* tilemap, iVec2 position, i32 x, i32 y, Pixel tint) {
+    Rect source;
+    const Image* page;
+
+    if(softGetTileRegion(tilemap, tilemap->tiles[y * tilemap->size.x + x], &source, &page)) {
+        softDrawImageRec((Image*)(page), source, (iVec2) { position.x + x * tilemap->tile_size.x, position.y + y * tilemap->tile_size.y }, tint);
+    }
+}
+
+internal bool softRenderTileChunk(Tilemap* tilemap, i32 chunk_x, i32 chunk_y) {
+    // Queued draws of the chunk still need its current pixels.
+    softFlushDeferred();
+
+    SoftTileChunk* chunk = &tilemap->chunks[chunk_y * tilemap->chunk_count.x + chunk_x];
+    Image* image = &chunk->image;
+
+    iVec2 first = { chunk_x * tilemap->chunk_tiles.x, chunk_y * tilemap->chunk_tiles.y };
+    iVec2 cells = { SOFT_MIN(tilemap->chunk_tiles.x, tilemap->size.x - first.x), SOFT_MIN(tilemap->chunk_tiles.y, tilemap->size.y - first.y) };
+
+    if(!image->data) {
+        image->size = (iVec2) { cells.x * tilemap->tile_size.x, cells.y * tilemap->tile_size.y };
+        image->channels = 4;
+        image->data = (PixelBuffer)malloc((size_t)(image->size.x) * image->size.y * sizeof(Pixel));
+
+        if(!image->data) {
+            softLogError("softDrawTilemap: %s", strerror(errno));
+            return false;
+        }
+    }
+
+    // The tiles are copied as they are (blending happens when the chunk is drawn); empty cells stay transparent.
+    memset(image->data, 0, (size_t)(image->size.x) * image->size.y * sizeof(Pixel));
+    chunk->full = true;
+
+    for(i32 y = 0; y < cells.y; y++) {
+        for(i32 x = 0; x < cells.x; x++) {
+            Rect source;
+            const Image* page;
+
+            if(!softGetTileRegion(tilemap, tilemap->tiles[(first.y + y) * tilemap->size.x + first.x + x], &source, &page)) {
+                chunk->full = false;
+                continue;
+            }
+
+            if(source.size.x < tilemap->tile_size.x || source.size.y < tilemap->tile_size.y) {
+                chunk->full = false;
+            }
+
+            Pixel* dst = &image->data[y * tilemap->tile_size.y * image->size.x + x * tilemap->tile_size.x];
+
+            for(i32 row = 0; row < source.size.y; row++) {
+                memcpy(
+                    dst + row * image->size.x, 
+                    &page->data[(source.position.y + row) * page->size.x + source.position.x], 
+                    source.size.x * sizeof(Pixel)
+                );
+            }
+        }
+    }
+
+    softEncodeImageRuns(image);
+    chunk->dirty = false;
+
+    return true;
+}
+
+// ------------------------------
+// Image loading.
+// softLoadImageAsync queues the decode for a small pool of worker threads. The queue is only locked to push and pop jobs;
+// completion is a per-job atomic flag (polled by softImageReady), plus a semaphore for softWaitImage to sleep on.
+// ------------------------------
+
+internal bool softDecodeImage(const string path, bool runs, Image* result) {
+    stbi_uc* data = stbi_load(
+        path, 
+        &result->size.x, 
+        &result->size.y, 
+        &result->channels, 
+        STBI_rgb_alpha
+    );
+
+    if(!data) {
+        softLogError("Image loading failure: %s", stbi_failure_reason());
+        *result = (Image) { 0 };
+        return false;
+    }
+
+    // RGBA bytes already are 0xAABBGGRR pixels on little endian machines, so the decoded buffer becomes the image data.
+    result->data = (PixelBuffer)(data);
+    result->runs = NULL;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for(i32 i = 0; i < result->size.x * result->size.y; i++) {
+        Pixel pixel = result->data[i];
+        result->data[i] = (pixel >> 24) | ((pixel >> 8) & 0xFF00) | ((pixel << 8) & 0xFF0000) | (pixel << 24);
+    }
+#endif
+
+    if(runs) {
+        result->runs = softBuildImageRuns(result);
+    }
+
+    return true;
+}
+
+internal void softFinishImageJob(ImageJob* job) {
+    // SDL atomics are full barriers: the image is visible before the flag is.
+    SDL_AtomicSet(&job->done, 1);
+    SDL_SemPost(job->finished);
+}
+
+internal i32 softLoaderWorker(void* data) {
+    (void)data;
+
+    while(true) {
+        SDL_SemWait(CORE.Loader.pending);
+        SDL_LockMutex(CORE.Loader.lock);
+
+        ImageJob* job = CORE.Loader.head;
+
+        if(job) {
+            CORE.Loader.head = job->next;
+
+            if(!CORE.Loader.head) {
+                CORE.Loader.tail = NULL;
+            }
+        }
+
+        SDL_UnlockMutex(CORE.Loader.lock);
+
+        // An empty queue means the pool is shutting down (see: softCloseLoader).
+        if(!job) {
+            return 0;
+        }
+
+        if(softDecodeImage((const string)(job->path), job->runs, &job->image)) {
+            softLogInfo("softLoadImageAsync: Image loaded successfully: %s (%ix%ipx)", job->path, job->image.size.x, job->image.size.y);
+        }
+
+        softFinishImageJob(job);
+    }
+}
+
+internal bool softInitLoader(void) {
+    CORE.Loader.lock = SDL_CreateMutex();
+    CORE.Loader.pending = SDL_CreateSemaphore(0);
+
+    if(!CORE.Loader.lock || !CORE.Loader.pending) {
+        softLogError("softInitLoader: %s", SDL_GetError());
+        return false;
+    }
+
+    // The main thread keeps a core to itself.
+    i32 count = SOFT_CLAMP(SDL_GetCPUCount() - 1, 1, SOFT_LOADER_WORKERS_MAX);
+
+    for(i32 i = 0; i < count; i++) {
+        SDL_Thread* worker = SDL_CreateThread(softLoaderWorker, "softLoaderWorker", NULL);
+
+        if(!worker) {
+            softLogWarning("softInitLoader: %s", SDL_GetError());
+            break;
+        }
+
+        CORE.Loader.workers[CORE.Loader.worker_count++] = worker;
+    }
+
+    if(CORE.Loader.worker_count == 0) {
+        return false;
+    }
+
+    softLogInfo("softInitLoader: Image loader started (%i workers).", CORE.Loader.worker_count);
+
+    return true;
+}
+
+internal void softCloseLoader(void) {
+    if(!CORE.Loader.lock) {
+        return;
+    }
+
+    // Jobs that didn't start yet are finished with an empty image, so softWaitImage never blocks forever.
+    SDL_LockMutex(CORE.Loader.lock);
+
+    ImageJob* job = CORE.Loader.head;
+    CORE.Loader.head = NULL;
+    CORE.Loader.tail = NULL;
+
+    SDL_UnlockMutex(CORE.Loader.lock);
+
+    for(ImageJob* next; job; job = next) {
+        next = job->next;
+        softFinishImageJob(job);
+    }
+
+    for(i32 i = 0; i < CORE.Loader.worker_count; i++) {
+        SDL_SemPost(CORE.Loader.pending);
+    }
+
+    for(i32 i = 0; i < CORE.Loader.worker_count; i++) {
+        SDL_WaitThread(CORE.Loader.workers[i], NULL);
+    }
+
+    SDL_DestroySemaphore(CORE.Loader.pending);
+    SDL_DestroyMutex(CORE.Loader.lock);
+    memset(&CORE.Loader, 0, sizeof(CORE.Loader));
+}
+
+// ------------------------------
+// Asset packs.
+// A pack stores images already converted to pixels, so loading one is a memory map: the images point straight into it
+// and the pages are read from the disk when they're first touched. The mapping is private (copy-on-write),
+// so drawing into a packed image never changes the file.
+// ------------------------------
+
+internal bool softMapFile(const string path, u8** data, u64* size) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if(file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER length;
+    HANDLE mapping = GetFileSizeEx(file, &length) && length.QuadPart > 0 ? CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL) : NULL;
+    CloseHandle(file);
+
+    if(!mapping) {
+        return false;
+    }
+
+    *data = (u8*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    *size = (u64)(length.QuadPart);
+    CloseHandle(mapping);
+
+    return *data != NULL;
+#else
+    i32 file = open(path, O_RDONLY);
+
+    if(file < 0) {
+        return false;
+    }
+
+    struct stat info;
+    void* mapping = fstat(file, &info) == 0 && info.st_size > 0 ? mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    close(file);
+
+    if(mapping == MAP_FAILED) {
+        return false;
+    }
+
+    *data = (u8*)(mapping);
+    *size = (u64)(info.st_size);
+
+    return true;
+#endif
+}
+
+internal void softUnmapFile(u8* data, u64 size) {
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+internal bool softValidatePack(const u8* data, u64 size) {
+    const SoftPackHeader* header = (const SoftPackHeader*)(data);
+
+    if(size < sizeof(SoftPackHeader) || header->magic != SOFT_PACK_MAGIC || header->version != SOFT_PACK_VERSION) {
+        return false;
+    }
+
+    if((size - sizeof(SoftPackHeader)) / sizeof(SoftPackEntry) < header->image_count) {
+        return false;
+    }
+
+    const SoftPackEntry* entries = (const SoftPackEntry*)(header + 1);
+
+    for(u32 i = 0; i < header->image_count; i++) {
+        const SoftPackEntry* entry = &entries[i];
+        u64 length = (u64)(entry->width) * (u64)(entry->height) * sizeof(Pixel);
+
+        if(entry->width <= 0 || entry->height <= 0 || entry->offset % SOFT_PACK_ALIGNMENT != 0 || entry->offset > size || length > size - entry->offset) {
+            return false;
+        }
+
+        if(memchr(entry->name, 0, SOFT_PACK_NAME_SIZE) == NULL) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+internal bool softPackOwns(const void* data) {
+    for(i32 i = 0; i < CORE.Packs.count; i++) {
+        const Pack* pack = &CORE.Packs.packs[i];
+
+        if((const u8*)(data) >= pack->data && (const u8*)(data) < pack->data + pack->size) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+internal void softUnloadPacks(void) {
+    while(CORE.Packs.count > 0) {
+        Pack pack = CORE.Packs.packs[CORE.Packs.count - 1];
+        softUnloadPack(&pack);
+    }
+}
+
+// ------------------------------
+// Resources.
+// Images loaded through softLoadImageResource are cached by path and reference counted: loading a path again returns
+// the same image.
+// With a memory budget, the least recently used images get evicted and are reloaded on their next use.
+// The table maps the path hash to a slot index (linear probing, power of two capacity, grown at 70% load); handles carry
+// the slot generation, so a handle to an unloaded image never resolves to whatever reuses its slot.
+// softRegisterImage is not a cache: it only has softUnloadResources free an image the caller loaded and keeps pointing to.
+// ------------------------------
+
+internal u32 softHashPath(const char* path) {
+    // FNV-1a
+    u32 hash = 2166136261u;
+
+    for(; *path; path++) {
+        hash = (hash ^ (u8)(*path)) * 16777619u;
+    }
+
+    return hash;
+}
+
+internal i32 softFindResourceEntry(const char* path, u32 hash) {
+    // Returns the table position holding [path], or -1.
+    if(!CORE.Resources.table) {
+        return -1;
+    }
+
+    i32 mask = CORE.Resources.table_capacity - 1;
+
+    for(i32 i = hash & mask;; i = (i + 1) & mask) {
+        i32 slot = CORE.Resources.table[i];
+
+        if(slot == SOFT_RESOURCE_TABLE_EMPTY) {
+            return -1;
+        }
+
+        if(slot >= 0 && CORE.Resources.slots[slot].hash == hash && strcmp(CORE.Resources.slots[slot].path, path) == 0) {
+            return i;
+        }
+    }
+}
+
+internal void softInsertResourceEntry(i32 slot) {
+    i32 mask = CORE.Resources.table_capacity - 1;
+    i32 i = CORE.Resources.slots[slot].hash & mask;
+
+    for(; CORE.Resources.table[i] >= 0; i = (i + 1) & mask);
+
+    if(CORE.Resources.table[i] == SOFT_RESOURCE_TABLE_EMPTY) {
+        CORE.Resources.table_used++;
+    }
+
+    CORE.Resources.table[i] = slot;
+}
+
+internal bool softReserveResources(void) {
+    // Room for one more image: the slots double when they're full, the table when it's over 70% full (rehashing drops the deleted entries).
+    if(CORE.Resources.free_slot == 0 && CORE.Resources.slot_count == CORE.Resources.slot_capacity) {
+        i32 capacity = SOFT_MAX(CORE.Resources.slot_capacity * 2, 16);
+        SoftResource* slots = (SoftResource*)realloc(CORE.Resources.slots, capacity * sizeof(SoftResource));
+
+        if(!slots) {
+            softLogError("softLoadImageResource: %s", strerror(errno));
+            return false;
+        }
+
+        CORE.Resources.slots = slots;
+        CORE.Resources.slot_capacity = capacity;
+    }
+
+    if((CORE.Resources.table_used + 1) * 10 > CORE.Resources.table_capacity * 7) {
+        i32 live = 0;
+
+        for(i32 i = 0; i < CORE.Resources.slot_count; i++) {
+            live += CORE.Resources.slots[i].references > 0;
+        }
+
+        i32 capacity = 32;
+
+        for(; (live + 1) * 10 > capacity * 5; capacity *= 2);
+
+        i32* table = (i32*)malloc(capacity * sizeof(i32));
+
+        if(!table) {
+            softLogError("softLoadImageResource: %s", strerror(errno));
+            return false;
+        }
+
+        for(i32 i = 0; i < capacity; i++) {
+            table[i] = SOFT_RESOURCE_TABLE_EMPTY;
+        }
+
+        free(CORE.Resources.table);
+        CORE.Resources.table = table;
+        CORE.Resources.table_capacity = capacity;
+        CORE.Resources.table_used = 0;
+
+        for(i32 i = 0; i < CORE.Resources.slot_count; i++) {
+            if(CORE.Resources.slots[i].references > 0) {
+                softInsertResourceEntry(i);
+            }
+        }
+    }
+
+    return true;
+}
+
+internal SoftResource* softGetResource(ImageHandle handle) {
+    if(handle.index >= (u32)(CORE.Resources.slot_count)) {
+        return NULL;
+    }
+
+    SoftResource* resource = &CORE.Resources.slots[handle.index];
+
+    return resource->references > 0 && resource->generation == handle.generation ? resource : NULL;
+}
+
+internal u64 softImageBytes(const Image* image) {
+    return (u64)(image->size.x) * (u64)(image->size.y) * sizeof(Pixel);
+}
+
+internal void softSetResourceImage(SoftResource* resource, Image image) {
+    resource->image = image;
+    CORE.Resources.memory_used += softImageBytes(&image);
+}
+
+internal void softEvictResource(SoftResource* resource) {
+    CORE.Resources.memory_used -= softImageBytes(&resource->image);
+    softUnloadImage(&resource->image);
+    resource->image.data = NULL;
+}
+
+internal void softEnforceImageBudget(void) {
+    // Evicts the least recently used images until the cached ones fit in the budget.
+    // Pinned images, and the ones used during this frame (the caller may still hold their data), are kept.
+    while(CORE.Resources.budget > 0 && CORE.Resources.memory_used > CORE.Resources.budget) {
+        SoftResource* victim = NULL;
+
+        for(i32 i = 0; i < CORE.Resources.slot_count; i++) {
+            SoftResource* resource = &CORE.Resources.slots[i];
+
+            if(resource->references == 0 || !resource->image.data || resource->pinned || resource->last_frame == CORE.Time.frame_count + 1) {
+                continue;
+            }
+
+            if(!victim || resource->last_used < victim->last_used) {
+                victim = resource;
+            }
+        }
+
+        if(!victim) {
+            return;
+        }
+
+        softEvictResource(victim);
+    }
+}
+
+internal void softReloadResource(SoftResource* resource) {
+    // Evicted images come back asynchronously: they're missing (empty) until the worker is done.
+    // Without the worker pool they're reloaded right away.
+    if(!resource->job) {
+        resource->job = softLoadImageAsync(resource->path);
+
+        if(!resource->job) {
+            Image image = softLoadImage(resource->path);
+
+            if(image.data) {
+                softSetResourceImage(resource, image);
+                softEnforceImageBudget();
+            }
+
+            return;
+        }
+    }
+
+    if(softImageReady(resource->job)) {
+        Image image = softWaitImage(resource->job);
+        resource->job = NULL;
+
+        if(image.data) {
+            softSetResourceImage(resource, image);
+            softEnforceImageBudget();
+        }
+    }
+}
+
+internal void softReleaseResource(i32 slot) {
+    SoftResource* resource = &CORE.Resources.slots[slot];
+    i32 entry = softFindResourceEntry(resource->path, resource->hash);
+
+    if(entry >= 0) {
+        CORE.Resources.table[entry] = SOFT_RESOURCE_TABLE_DELETED;
+    }
+
+    if(resource->job) {
+        Image image = softWaitImage(resource->job);
+
+        if(image.data) {
+            softUnloadImage(&image);
+        }
+    }
+
+    if(resource->image.data) {
+        softEvictResource(resource);
+    }
+
+    free(resource->path);
+
+    *resource = (SoftResource) { .generation = resource->generation + 1, .next_free = CORE.Resources.free_slot };
+    CORE.Resources.free_slot = slot + 1;
+}
+
+internal softKeyCode keycode_to_scancode[] = {
+    KEY_NULL,
+    
+    0,
+    0,
+    0,
+
+    KEY_A,
+    KEY_B,
+    KEY_C,
+    KEY_D,
+    KEY_E,
+    KEY_F,
+    KEY_G,
+    KEY_H,
+    KEY_I,
+    KEY_J,
+    KEY_K,
+    KEY_L,
+    KEY_M,
+    KEY_N,
+    KEY_O,
+    KEY_P,
+    KEY_Q,
+    KEY_R,
+    KEY_S,
+    KEY_T,
+    KEY_U,
+    KEY_V,
+    KEY_W,
+    KEY_X,
+    KEY_Y,
+    KEY_Z,
+
+    KEY_ONE, 
+    KEY_TWO, 
+    KEY_THREE, 
+    KEY_FOUR, 
+    KEY_FIVE, 
+    KEY_SIX, 
+    KEY_SEVEN, 
+    KEY_EIGHT, 
+    KEY_NINE, 
+    KEY_ZERO, 
+
+    0, // SDL_SCANCODE_RETURN
+
+    KEY_ESCAPE,
+    KEY_BACKSPACE,
+    KEY_TAB,
+    KEY_SPACE,
+
+    KEY_MINUS,
+    KEY_EQUALS,
+    KEY_LSQB,
+    KEY_RSQB,
+    KEY_BSLASH,
+
+    0, // SDL_SCANCODE_NONUSHASH
+
+    KEY_SEMI,
+    KEY_APOS,
+    KEY_GRAVE,
+    KEY_COMMA,
+    KEY_PERIOD,
+    KEY_SLASH,
+    KEY_CAPS,
+    KEY_F1, 
+    KEY_F2, 
+    KEY_F3, 
+    KEY_F4, 
+    KEY_F5, 
+    KEY_F6, 
+    KEY_F7, 
+    KEY_F8, 
+    KEY_F9, 
+    KEY_F10, 
+    KEY_F11, 
+    KEY_F12, 
+
+    0, // SDL_SCANCODE_PRINTSCREEN
+    0, // SDL_SCANCODE_SCROLLLOCK
+    0, // SDL_SCANCODE_PAUSE
+    0, // SDL_SCANCODE_INSERT
+    0, // SDL_SCANCODE_HOME
+    0, // SDL_SCANCODE_PAGEUP
+
+    KEY_DEL,
+
+    0, // SDL_SCANCODE_END
+    0, // SDL_SCANCODE_PAGEDOWN
+
+    KEY_RIGHT, 
+    KEY_LEFT, 
+    KEY_DOWN, 
+    KEY_UP, 
+
+    0, // SDL_SCANCODE_KP_DIVIDE
+    0, // SDL_SCANCODE_KP_MULTIPLY
+    0, // SDL_SCANCODE_KP_MINUS
+    0, // SDL_SCANCODE_KP_PLUS
+    0, // SDL_SCANCODE_KP_ENTER
+    0, // SDL_SCANCODE_KP_1
+    0, // SDL_SCANCODE_KP_2
+    0, // SDL_SCANCODE_KP_3
+    0, // SDL_SCANCODE_KP_4
+    0, // SDL_SCANCODE_KP_5
+    0, // SDL_SCANCODE_KP_6
+    0, // SDL_SCANCODE_KP_7
+    0, // SDL_SCANCODE_KP_8
+    0, // SDL_SCANCODE_KP_9
+    0, // SDL_SCANCODE_KP_0
+    0, // SDL_SCANCODE_KP_PERIOD
+    0, // SDL_SCANCODE_NONUSBACKSLASH 
+    0, // SDL_SCANCODE_POWER 
+    0, // SDL_SCANCODE_KP_EQUALS 
+    0, // SDL_SCANCODE_F13 
+    0, // SDL_SCANCODE_F14 
+    0, // SDL_SCANCODE_F15 
+    0, // SDL_SCANCODE_F16 
+    0, // SDL_SCANCODE_F17 
+    0, // SDL_SCANCODE_F18 
+    0, // SDL_SCANCODE_F19 
+    0, // SDL_SCANCODE_F20 
+    0, // SDL_SCANCODE_F21 
+    0, // SDL_SCANCODE_F22 
+    0, // SDL_SCANCODE_F23 
+    0, // SDL_SCANCODE_F24 
+    0, // SDL_SCANCODE_EXECUTE 
+    0, // SDL_SCANCODE_HELP 
+    0, // SDL_SCANCODE_MENU 
+    0, // SDL_SCANCODE_SELECT 
+    0, // SDL_SCANCODE_STOP 
+    0, // SDL_SCANCODE_AGAIN 
+    0, // SDL_SCANCODE_UNDO 
+    0, // SDL_SCANCODE_CUT 
+    0, // SDL_SCANCODE_COPY 
+    0, // SDL_SCANCODE_PASTE 
+    0, // SDL_SCANCODE_FIND 
+    0, // SDL_SCANCODE_MUTE 
+    0, // SDL_SCANCODE_VOLUMEUP 
+    0, // SDL_SCANCODE_VOLUMEDOWN 
+    0, // SDL_SCANCODE_KP_COMMA 
+    0, // SDL_SCANCODE_KP_EQUALSAS400 
+    0, // SDL_SCANCODE_INTERNATIONAL1 
+    0, // SDL_SCANCODE_INTERNATIONAL2 
+    0, // SDL_SCANCODE_INTERNATIONAL3 
+    0, // SDL_SCANCODE_INTERNATIONAL4 
+    0, // SDL_SCANCODE_INTERNATIONAL5 
+    0, // SDL_SCANCODE_INTERNATIONAL6 
+    0, // SDL_SCANCODE_INTERNATIONAL7 
+    0, // SDL_SCANCODE_INTERNATIONAL8 
+    0, // SDL_SCANCODE_INTERNATIONAL9 
+    0, // SDL_SCANCODE_LANG1 
+    0, // SDL_SCANCODE_LANG2 
+    0, // SDL_SCANCODE_LANG3 
+    0, // SDL_SCANCODE_LANG4 
+    0, // SDL_SCANCODE_LANG5 
+    0, // SDL_SCANCODE_LANG6 
+    0, // SDL_SCANCODE_LANG7 
+    0, // SDL_SCANCODE_LANG8 
+    0, // SDL_SCANCODE_LANG9 
+    0, // SDL_SCANCODE_ALTERASE 
+    0, // SDL_SCANCODE_SYSREQ 
+    0, // SDL_SCANCODE_CANCEL 
+    0, // SDL_SCANCODE_CLEAR 
+    0, // SDL_SCANCODE_PRIOR 
+    0, // SDL_SCANCODE_RETURN2 
+    0, // SDL_SCANCODE_SEPARATOR 
+    0, // SDL_SCANCODE_OUT 
+    0, // SDL_SCANCODE_OPER 
+    0, // SDL_SCANCODE_CLEARAGAIN 
+    0, // SDL_SCANCODE_CRSEL 
+    0, // SDL_SCANCODE_EXSEL 
+    0, // SDL_SCANCODE_KP_00 
+    0, // SDL_SCANCODE_KP_000 
+    0, // SDL_SCANCODE_THOUSANDSSEPARATOR 
+    0, // SDL_SCANCODE_DECIMALSEPARATOR 
+    0, // SDL_SCANCODE_CURRENCYUNIT 
+    0, // SDL_SCANCODE_CURRENCYSUBUNIT 
+    0, // SDL_SCANCODE_KP_LEFTPAREN 
+    0, // SDL_SCANCODE_KP_RIGHTPAREN 
+    0, // SDL_SCANCODE_KP_LEFTBRACE 
+    0, // SDL_SCANCODE_KP_RIGHTBRACE 
+    0, // SDL_SCANCODE_KP_TAB 
+    0, // SDL_SCANCODE_KP_BACKSPACE 
+    0, // SDL_SCANCODE_KP_A 
+    0, // SDL_SCANCODE_KP_B 
+    0, // SDL_SCANCODE_KP_C 
+    0, // SDL_SCANCODE_KP_D 
+    0, // SDL_SCANCODE_KP_E 
+    0, // SDL_SCANCODE_KP_F 
+    0, // SDL_SCANCODE_KP_XOR 
+    0, // SDL_SCANCODE_KP_POWER 
+    0, // SDL_SCANCODE_KP_PERCENT 
+    0, // SDL_SCANCODE_KP_LESS 
+    0, // SDL_SCANCODE_KP_GREATER 
+    0, // SDL_SCANCODE_KP_AMPERSAND 
+    0, // SDL_SCANCODE_KP_DBLAMPERSAND 
+    0, // SDL_SCANCODE_KP_VERTICALBAR 
+    0, // SDL_SCANCODE_KP_DBLVERTICALBAR 
+    0, // SDL_SCANCODE_KP_COLON 
+    0, // SDL_SCANCODE_KP_HASH 
+    0, // SDL_SCANCODE_KP_SPACE 
+    0, // SDL_SCANCODE_KP_AT 
+    0, // SDL_SCANCODE_KP_EXCLAM 
+    0, // SDL_SCANCODE_KP_MEMSTORE 
+    0, // SDL_SCANCODE_KP_MEMRECALL 
+    0, // SDL_SCANCODE_KP_MEMCLEAR 
+    0, // SDL_SCANCODE_KP_MEMADD 
+    0, // SDL_SCANCODE_KP_MEMSUBTRACT 
+    0, // SDL_SCANCODE_KP_MEMMULTIPLY 
+    0, // SDL_SCANCODE_KP_MEMDIVIDE 
+    0, // SDL_SCANCODE_KP_PLUSMINUS 
+    0, // SDL_SCANCODE_KP_CLEAR 
+    0, // SDL_SCANCODE_KP_CLEARENTRY 
+    0, // SDL_SCANCODE_KP_BINARY 
+    0, // SDL_SCANCODE_KP_OCTAL 
+    0, // SDL_SCANCODE_KP_DECIMAL 
+    0, // SDL_SCANCODE_KP_HEXADECIMAL 
+
+    KEY_LCTRL, 
+    KEY_LSHIFT, 
+    KEY_LALT, 
+
+    0, // SDL_SCANCODE_LGUI 
+
+    KEY_RCTRL,
+    KEY_RSHIFT,
+    KEY_RALT,
+    
+    0, // SDL_SCANCODE_RGUI
+    0, // SDL_SCANCODE_MODE
+};
+
+internal softKeyCode SDLScancodeToSoftKeyCode(SDL_Scancode code) {
+    if(code >= 0 || code < sizeof(keycode_to_scancode) / sizeof(softKeyCode)) {
+        return keycode_to_scancode[code];
+    }
+
+    return KEY_NULL;
+}
+
+internal void softTimeMenagement() {
+    CORE.Time.frame_count++;
+    CORE.Time.current = softTime();
+    f32 frame_time = CORE.Time.current - CORE.Time.previous;
+    CORE.Time.previous = CORE.Time.current;
+
+    CORE.Time.delta_time = frame_time;
+
+    if(CORE.Time.delta_time < CORE.Time.frame_target) {
+        softWait(CORE.Time.frame_target - CORE.Time.delta_time);
+
+        CORE.Time.current = softTime();
+        f32 wait_time = CORE.Time.current - CORE.Time.previous;
+        CORE.Time.previous = CORE.Time.current;
+
+        CORE.Time.delta_time += wait_time;
+    }
+
+    // The window is measured with the performance counter: the tick clock above only has a millisecond resolution.
+    u64 frame_end = SDL_GetPerformanceCounter();
+
+    if(CORE.Time.frame_end) {
+        CORE.Time.frame_times[CORE.Time.frame_time_next] = (f32)((d32)(frame_end - CORE.Time.frame_end) / SDL_GetPerformanceFrequency());
+        CORE.Time.frame_time_next = (CORE.Time.frame_time_next + 1) % SOFT_FRAME_TIME_WINDOW;
+        CORE.Time.frame_time_count = SOFT_MIN(CORE.Time.frame_time_count + 1, SOFT_FRAME_TIME_WINDOW);
+    }
+
+    CORE.Time.frame_end = frame_end;
+}
+
+internal i32 softCompareFrameTimes(const void* a, const void* b) {
+    f32 x = *(const f32*)a;
+    f32 y = *(const f32*)b;
+
+    return (x > y) - (x < y);
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_CONFIG
+// ------------------------------------------------------
+
+SAPI void softAlphaBlendState(bool state) {
+    state ?
+        softLogInfo("softAlphaBlendState: Alpha-Blending: ENABLED (\"Alpha\" channle will be used during the color calculations).") :
+        softLogInfo("softAlphaBlendState: Alpha-Blending: DISABLED (\"Alpha\" channle will be immited during the color calculations).");
+
+    // Without blending, BLANK pixels still aren't drawn: they're the color key.
+    CORE.Config.blend_mode = state ? BLEND_ALPHA : BLEND_COLOR_KEY;
+}
+
+SAPI void softSetBlendMode(SoftBlendMode mode) {
+    if(mode < BLEND_REPLACE || mode >= BLEND_COUNT) {
+        softLogWarning("softSetBlendMode: Invalid blend mode: %i. Returning...", mode);
+        return;
+    }
+
+    CORE.Config.blend_mode = mode;
+}
+
+SAPI SoftBlendMode softGetBlendMode(void) {
+    return CORE.Config.blend_mode;
+}
+
+SAPI void softSetImageFilter(SoftImageFilter filter) {
+    if(filter != FILTER_NEAREST && filter != FILTER_BILINEAR) {
+        softLogWarning("softSetImageFilter: Invalid image filter: %i. Returning...", filter);
+        return;
+    }
+
+    CORE.Config.image_filter = filter;
+}
+
+SAPI void softSetFillRule(SoftFillRule rule) {
+    if(rule != FILL_NONZERO && rule != FILL_EVEN_ODD) {
+        softLogWarning("softSetFillRule: Invalid fill rule: %i. Returning...", rule);
+        return;
+    }
+
+    CORE.Config.fill_rule = rule;
+}
+
+SAPI SoftFillRule softGetFillRule(void) {
+    return CORE.Config.fill_rule;
+}
+
+SAPI void softSetLineJoin(SoftLineJoin join) {
+    if(join != JOIN_MITER && join != JOIN_ROUND && join != JOIN_BEVEL) {
+        softLogWarning("softSetLineJoin: Invalid line join: %i. Returning...", join);
+        return;
+    }
+
+    CORE.Config.line_join = join;
+}
+
+SAPI SoftLineJoin softGetLineJoin(void) {
+    return CORE.Config.line_join;
+}
+
+SAPI void softSetLineCap(SoftLineCap cap) {
+    if(cap != CAP_BUTT && cap != CAP_ROUND && cap != CAP_SQUARE) {
+        softLogWarning("softSetLineCap: Invalid line cap: %i. Returning...", cap);
+        return;
+    }
+
+    CORE.Config.line_cap = cap;
+}
+
+SAPI SoftLineCap softGetLineCap(void) {
+    return CORE.Config.line_cap;
+}
+
+SAPI void softSetImageRunEncoding(bool state) {
+    // Images loaded from now on get their run encoding built (see: softEncodeImageRuns).
+    CORE.Config.image_runs = state;
+}
+
+SAPI bool softGetImageRunEncoding(void) {
+    return CORE.Config.image_runs;
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_WINDOW
+// ------------------------------------------------------
+
+SAPI i32 softInit(i32 width, i32 height, const string title) { 
+    softInitPlatform();
+    softInitWindow(width, height, title);
+    softInitRenderer();
+    softInitDefaultPixelBuffer();
+
+    softLogInfo("softInit: Initialization process overview:");
+    softLogInfo("   > Window state: %s", CORE.Window.valid ? "OK" : "FAIL");
+    softLogInfo("   > Renderer state: %s", CORE.Render.renderer_valid ? "OK" : "FAIL");
+    softLogInfo("   > Render Texture state: %s", CORE.Render.render_texture ? "OK" : "FAIL");
+    softLogInfo("   > Pixel Data state: %s", CORE.PixelBuffer.pixel_buffer ? "OK" : "FAIL");
+    softLogInfo("softInit: Initialization finished. Hello World!");
+
+    return SOFT_SUCCESS;
+}
+
+SAPI i32 softInitPlatform(void) {
+    softLogInfo("softInitPlatform: Initializing Soft v.%s", SOFT_VERSION);
+    i32 init = SDL_Init(SDL_INIT_VIDEO);
+
+    if(init != 0) {
+        softLogError("softInitPlatform: %s", SDL_GetError());
+        
+        return SOFT_FAILED;
+    }
+
+    strcpy(CORE.Platform.version, softTextFormat("%d.%d.%d", SDL_MAJOR_VERSION, SDL_MINOR_VERSION, SDL_PATCHLEVEL));
+    
+    softAlphaBlendState(true);
+
+    softLogInfo("   > Platform Version: %s", CORE.Platform.version);
+    softLogInfo("   > Version: %s", SOFT_VERSION);
+    softLogInfo("   > Version major: %i", SOFT_VERSION_MAJOR);
+    softLogInfo("   > Version minor: %i", SOFT_VERSION_MINOR);
+
+    CORE.Platform.valid = true;
+
+    return SOFT_SUCCESS;
+}
+
+SAPI i32 softInitWindow(i32 width, i32 height, const string title) {
+    softLogInfo("softInitWindow: Initializing Window.");
+
+    CORE.Window.screen_size = (iVec2) { width, height };
+
+    SDL_DisplayMode mode;
+    SDL_GetCurrentDisplayMode(0, &mode);
+    CORE.Window.display_size = (iVec2) { mode.w, mode.h };
+
+    CORE.Window.quit = false;
+
+    CORE.Input.Mouse.offset = (iVec2) { 0 };
+    CORE.Input.Mouse.scale = (iVec2) { 1, 1 };
+
+    CORE.Input.Keyboard.exit_key = KEY_ESCAPE;
+
+    u32 flags = 0;
+    if(CORE.Window.config_flags & FLAG_WINDOW_RESIZABLE) flags |= SDL_WINDOW_RESIZABLE;
+    if(CORE.Window.config_flags & FLAG_WINDOW_FULLSCREEN) flags |= SDL_WINDOW_FULLSCREEN;
+    if(CORE.Window.config_flags & FLAG_WINDOW_MAXIMIZED) flags |= SDL_WINDOW_MAXIMIZED;
+    if(CORE.Window.config_flags & FLAG_WINDOW_MINIMIZED) flags |= SDL_WINDOW_MINIMIZED;
+    if(CORE.Window.config_flags & FLAG_WINDOW_HIGHDPI) flags |= SDL_WINDOW_ALLOW_HIGHDPI;
+
+    CORE.Window.window = SDL_CreateWindow(
+        title, 
+        SDL_WINDOWPOS_CENTERED, 
+        SDL_WINDOWPOS_CENTERED, 
+        width, 
+        height, 
+        flags
+    );
+
+    if(!CORE.Window.window) {
+        softLogError("softInitWindow: %s", SDL_GetError());
+
+        softClosePlatform();
+        
+        return SOFT_FAILED;
+    }
+
+    CORE.Window.valid = true;
+
+    softLogInfo("   > Window size: %ix%i", CORE.Window.screen_size.x, CORE.Window.screen_size.y);
+    softLogInfo("   > Display size: %ix%i", CORE.Window.display_size.x, CORE.Window.display_size.y);
+
+    return SOFT_SUCCESS;
+}
+
+SAPI i32 softInitRenderer(void) {
+    softLogInfo("softInitRenderer: Initializing Renderer.");
+
+    if(!CORE.Window.window) {
+        softLogError("softInitRenderer: Renderer requires a valid Window instance. Returning...");
+
+        softClosePlatform();
+
+        return SOFT_FAILED;
+    }
+
+    u32 flags = 0;
+    flags |= SDL_RENDERER_ACCELERATED;
+
+    if(CORE.Window.config_flags & FLAG_WINDOW_VSYNC) {
+        flags |= SDL_RENDERER_PRESENTVSYNC;
+    }        
+
+    CORE.Render.renderer = SDL_CreateRenderer(
+        CORE.Window.window, 
+        -1, 
+        flags
+    );
+
+    if(!CORE.Render.renderer) {
+        softLogError("softInitRenderer: %s", SDL_GetError());
+
+        softCloseWindow();
+        softClosePlatform();
+        
+        return SOFT_FAILED;
+    }
+
+    softLogInfo("softInitRenderer: Initializing Render Texture.");
+
+    CORE.Render.render_texture = SDL_CreateTexture(
+        CORE.Render.renderer, 
+        SDL_PIXELFORMAT_ABGR8888, 
+        SDL_TEXTUREACCESS_STREAMING, 
+        CORE.Window.display_size.x, 
+        CORE.Window.display_size.y
+    );
+
+    if(!CORE.Render.render_texture) {
+        softLogError("softInitRenderer: %s", SDL_GetError());
+
+        softCloseWindow();
+        softCloseRenderer();
+        softClosePlatform();
+        
+        return SOFT_FAILED;
+    }
+
+    softLogInfo("   > RenderTexture size: %ix%i", CORE.Window.display_size.x, CORE.Window.display_size.y);
+
+    CORE.Render.size.x = CORE.Window.display_size.x;
+    CORE.Render.size.y = CORE.Window.display_size.y;
+
+    CORE.Render.renderer_valid = true;
+
+    return SOFT_SUCCESS;
+}
+
+SAPI void softClose(void) {
+    softLogInfo("softClose: Closing Soft v.%s", SOFT_VERSION);
+
+    // Draws still queued are dropped.
+    free(CORE.Deferred.commands);
+    memset(&CORE.Deferred, 0, sizeof(CORE.Deferred));
+    softSetDebugView(DEBUG_VIEW_NONE);
+
+    if(CORE.Recording.file) {
+        softEndRecording();
+    }
+
+    softCloseLoader();
+    softUnloadPacks();
+    softUnloadDefaultFonts();
+    softFrameFree();
+    softUnloadPixelBuffer();
+    softCloseRenderer();
+    softCloseWindow();
+    softClosePlatform();
+}
+
+SAPI void softClosePlatform(void) {
+    SDL_Quit();
+
+    softLogInfo("softClosePlatform: Quitting. Goodbye World...");
+    CORE.Platform.valid = false;
+}
+
+SAPI void softCloseWindow(void) {
+    if(!CORE.Window.window) {
+        softLogWarning("softCloseWindow: Window already closed. Returning...");
+
+        return;
+    }
+
+    softLogInfo("softCloseWindow: Closing window.");
+
+    SDL_DestroyWindow(CORE.Window.window);
+    CORE.Window.valid = false;
+}
+
+SAPI void softCloseRenderer(void) {
+    if(!CORE.Render.renderer) {
+        softLogWarning("softCloseRenderer: Renderer already closed. Returning...");
+
+        return;
+    }
+
+    softLogInfo("softCloseRenderer: Unloading renderer.");
+
+    SDL_DestroyRenderer(CORE.Render.renderer);
+    CORE.Render.renderer_valid = false;
+
+    if(!CORE.Render.render_texture) {
+        softLogWarning("softCloseRenderer: Render Texture already unloaded. Returning...");
+
+        return;
+    }
+
+    softLogInfo("softCloseRenderer: Unloading render texture.");
+
+    SDL_DestroyTexture(CORE.Render.render_texture);
+
+}
+
+SAPI i32 softInitDefaultPixelBuffer(void) {
+    softLogInfo("softInitDefaultPixelBuffer: Initializing Pixel Buffer.");
+
+    if(!CORE.Window.window || !CORE.Render.renderer || !CORE.Render.render_texture) {
+        softLogError("softInitDefaultPixelBuffer: %s", strerror(errno));
+
+        softCloseWindow();
+        softCloseRenderer();
+        softClosePlatform();
+        
+        return SOFT_FAILED;
+    }
+
+    CORE.PixelBuffer.size = (iVec2) { CORE.Window.display_size.x, CORE.Window.display_size.y };
+    CORE.Camera.view_valid = false;
+    CORE.PixelBuffer.pixel_buffer = (PixelBuffer)calloc(CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y, sizeof(Pixel));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softInitDefaultPixelBuffer: %s", strerror(errno));
+
+        softCloseWindow();
+        softCloseRenderer();
+        softClosePlatform();
+        
+        return SOFT_FAILED;
+    }
+
+    softLogInfo("   > Pixel count: %i (%i bytes)", CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y, CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y * sizeof(Pixel));
+
+    return SOFT_SUCCESS;
+}
+
+
+SAPI void softUnloadPixelBuffer(void) {
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogWarning("softUnloadPixelBuffer: Pixel Buffer already unloaded. Returning...");
+
+        return;
+    }
+
+    softLogInfo("softUnloadPixelBuffer: Unloading Pixel Buffer.");
+
+    free(CORE.PixelBuffer.pixel_buffer);
+}
+
+SAPI PixelBuffer softCreatePixelBuffer(i32 width, i32 height) {
+    softFlushDeferred();
+
+    softLogInfo("softCreatePixelBuffer: Creating a new pixel buffer (%ix%ipx)", width, height);
+    CORE.PixelBuffer.size = (iVec2) { width, height };
+    CORE.Camera.view_valid = false;
+    return (PixelBuffer)calloc(width * height, sizeof(Pixel));
+}
+
+SAPI i32 softSetCurrentPixelBuffer(PixelBuffer pixel_buffer) {
+    softFlushDeferred();
+
+    if(pixel_buffer == NULL) {
+        softLogError("softCreatePixelBuffer: Invalid new pixel buffer object. Returning...");
+
+        return SOFT_FAILED;
+    }
+
+    if(CORE.PixelBuffer.pixel_buffer != NULL) {
+        softLogInfo("softCreatePixelBuffer: Unloading previous pixel buffer.");
+        free(CORE.PixelBuffer.pixel_buffer);
+    }
+
+    CORE.PixelBuffer.pixel_buffer = pixel_buffer;
+    
+    if(CORE.PixelBuffer.pixel_buffer == NULL) {
+        softLogError("softCreatePixelBuffer: Failed to set the current pixel buffer. Returning...");
+        return SOFT_FAILED;
+    }
+    
+    softLogInfo("softCreatePixelBuffer: Current pixel buffer set successfully.");
+    return SOFT_SUCCESS;
+}
+
+SAPI bool softWindowShoulClose(void) {
+    return CORE.Window.quit;
+}
+
+SAPI void softCloseCallback(void) {
+    CORE.Window.quit = true;
+}
+
+SAPI iVec2 softGetWindowSize(void){
+    return CORE.Window.screen_size;
+}
+
+SAPI iVec2 softGetWindowCenter(void){
+    return (iVec2) { CORE.Window.screen_size.x / 2, CORE.Window.screen_size.y / 2 };
+}
+
+SAPI iVec2 softGetDisplaySize(void){
+    return CORE.Window.display_size;
+}
+
+SAPI iVec2 softGetDisplayCenter(void){
+    return (iVec2) { CORE.Window.display_size.x / 2, CORE.Window.display_size.y / 2 };
+}
+
+SAPI void softSetConfigFlags(softConfigFlags flags) {
+    CORE.Window.config_flags |= flags;
+}
+
+SAPI void softSetWindowTitle(const string title) {
+    SDL_SetWindowTitle(CORE.Window.window, title);
+    strcpy(CORE.Window.title, title);
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_EVENTS
+// ------------------------------------------------------
+
+
+SAPI void softPollEvents(void) {
+    for(i32 key = 0; key < SOFT_KEYCODE_COUNT_TOTAL; key++) {
+        CORE.Input.Keyboard.key_pressed_previous[key] = CORE.Input.Keyboard.key_pressed_current[key];
+    }
+
+    for(i32 button = 0; button < SOFT_MOUSEBUTTON_COUNT_TOTAL; button++) {
+        CORE.Input.Mouse.mouse_button_pressed_previous[button] = CORE.Input.Mouse.mouse_button_pressed_current[button];
+    }
+
+    SDL_Event event = { 0 };
+    while(SDL_PollEvent(&event)) {
+        switch(event.type) {
+            case SDL_WINDOWEVENT:
+                switch (event.window.event) {
+                    case SDL_WINDOWEVENT_SIZE_CHANGED:
+                        CORE.Window.screen_size.x = event.window.data1;
+                        CORE.Window.screen_size.y = event.window.data2;
+
+                        CORE.Window.screen_display_size_delta.x = CORE.Window.display_size.x - CORE.Window.screen_size.x;
+                        CORE.Window.screen_display_size_delta.y = CORE.Window.display_size.y - CORE.Window.screen_size.y;
+
+                        break;
+
+                    case SDL_WINDOWEVENT_CLOSE:
+                        softCloseCallback();
+                        
+                        break;
+
+                    case SDL_WINDOWEVENT_ENTER:
+                        CORE.Window.cursor_on_screen = true;
+                        
+                        break;
+
+                    case SDL_WINDOWEVENT_LEAVE:
+                        CORE.Window.cursor_on_screen = false;
+                        
+                        break;
+                }
+
+                break;
+
+            case SDL_KEYDOWN: {
+                softKeyCode key = SDLScancodeToSoftKeyCode(event.key.keysym.scancode);
+
+                if(key != KEY_NULL && key < SOFT_KEYCODE_COUNT_TOTAL) {
+                    CORE.Input.Keyboard.key_pressed_current[key] = true;
+                }
+
+                if(softKeyPressed(CORE.Input.Keyboard.exit_key)) {
+                    softCloseCallback();
+                }
+
+                break;
+            }
+
+            case SDL_KEYUP: {
+                softKeyCode key = SDLScancodeToSoftKeyCode(event.key.keysym.scancode);
+
+                if(key != KEY_NULL && key < SOFT_KEYCODE_COUNT_TOTAL) {
+                    CORE.Input.Keyboard.key_pressed_current[key] = false;
+                }
+
+                break;
+            }
+
+            case SDL_MOUSEMOTION:
+                CORE.Input.Mouse.position_previous = CORE.Input.Mouse.position_current;
+
+                CORE.Input.Mouse.position_current.x = event.motion.x;
+                CORE.Input.Mouse.position_current.y = event.motion.y;
+                
+                break;
+
+            case SDL_MOUSEWHEEL:
+                CORE.Input.Mouse.wheel_move.x = event.wheel.x;
+                CORE.Input.Mouse.wheel_move.y = event.wheel.y;
+                
+                break;
+
+            case SDL_MOUSEBUTTONDOWN: {
+                softMouseButtons button;
+
+                if(event.button.button == SDL_BUTTON_LEFT) button = BUTTON_LEFT;
+                else if(event.button.button == SDL_BUTTON_MIDDLE) button = BUTTON_MIDDLE;
+                else if(event.button.button == SDL_BUTTON_RIGHT) button = BUTTON_RIGHT;
+
+                CORE.Input.Mouse.mouse_button_pressed_current[button] = true;
+                
+                break;
+            }
+
+            case SDL_MOUSEBUTTONUP:{
+                softMouseButtons button;
+
+                if(event.button.button == SDL_BUTTON_LEFT) button = BUTTON_LEFT;
+                else if(event.button.button == SDL_BUTTON_MIDDLE) button = BUTTON_MIDDLE;
+                else if(event.button.button == SDL_BUTTON_RIGHT) button = BUTTON_RIGHT;
+
+                CORE.Input.Mouse.mouse_button_pressed_current[button] = false;
+
+                break;
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_INPUT
+// ------------------------------------------------------
+
+
+SAPI iVec2 softGetMousePosition(void) {
+    return (iVec2) {
+        (CORE.Input.Mouse.position_current.x + CORE.Input.Mouse.offset.x) * CORE.Input.Mouse.scale.x,
+        (CORE.Input.Mouse.position_current.y + CORE.Input.Mouse.offset.y) * CORE.Input.Mouse.scale.y
+    };
+}
+
+SAPI iVec2 softGetPreviousMousePosition(void) {
+    return (iVec2) {
+        (CORE.Input.Mouse.position_previous.x + CORE.Input.Mouse.offset.x) * CORE.Input.Mouse.scale.x,
+        (CORE.Input.Mouse.position_previous.y + CORE.Input.Mouse.offset.y) * CORE.Input.Mouse.scale.y
+    };
+}
+
+SAPI iVec2 softGetMouseDelta(void) {
+    return (iVec2) {
+        CORE.Input.Mouse.position_current.x - CORE.Input.Mouse.position_previous.x,
+        CORE.Input.Mouse.position_current.y - CORE.Input.Mouse.position_previous.y
+    };
+}
+
+SAPI iVec2 softGetMouseWheel(void) {
+    return CORE.Input.Mouse.wheel_move;
+}
+
+SAPI bool softKeyPressed(softKeyCode key) {
+    bool pressed = false;
+
+    if(CORE.Input.Keyboard.key_pressed_current[key] && !CORE.Input.Keyboard.key_pressed_previous[key]) {
+        pressed = true;
+    }
+
+    return pressed;
+}
+
+SAPI bool softKeyReleased(softKeyCode key) {    
+    bool released = false;
+
+    if(!CORE.Input.Keyboard.key_pressed_current[key] && CORE.Input.Keyboard.key_pressed_previous[key]) {
+        released = true;
+    }
+
+    return released;
+}
+
+SAPI bool softKeyDown(softKeyCode key) {
+    return CORE.Input.Keyboard.key_pressed_current[key];
+}
+
+SAPI bool softKeyUp(softKeyCode key) {    
+    return !CORE.Input.Keyboard.key_pressed_current[key];
+}
+
+SAPI bool softMouseButtonPressed(softMouseButtons button) {
+    bool pressed = false;
+
+    if(CORE.Input.Mouse.mouse_button_pressed_current[button] && !CORE.Input.Mouse.mouse_button_pressed_previous[button]) {
+        pressed = true;
+    }
+
+    return pressed;
+
+}
+
+SAPI bool softMouseButtonReleased(softMouseButtons button) {
+    bool released = false;
+
+    if(!CORE.Input.Mouse.mouse_button_pressed_current[button] && CORE.Input.Mouse.mouse_button_pressed_previous[button]) {
+        released = true;
+    }
+
+    return released;
+
+}
+
+SAPI bool softMouseButtonDown(softMouseButtons button) {
+    return CORE.Input.Mouse.mouse_button_pressed_current[button];
+}
+
+SAPI bool softMouseButtonUp(softMouseButtons button) {
+    return !CORE.Input.Mouse.mouse_button_pressed_current[button];
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_RENDER
+// ------------------------------------------------------
+
+SAPI void softClearBuffer(void) {
+    SOFT_RECORD_CALL(SOFT_CALL_CLEAR, softClearBuffer());
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softClearBuffer: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    // Deferred: a replacing clear of the whole buffer (the clip rectangle doesn't apply here).
+    if(softDeferring()) {
+        i32 clip_count = CORE.Clip.count;
+        SoftBlendMode blend_mode = CORE.Config.blend_mode;
+
+        CORE.Clip.count = 0;
+        CORE.Config.blend_mode = BLEND_REPLACE;
+
+        SoftDrawCommand* command = softDeferCommand(SOFT_COMMAND_CLEAR, softGetClipBounds(), false, true, BLANK);
+
+        CORE.Clip.count = clip_count;
+        CORE.Config.blend_mode = blend_mode;
+
+        if(command) {
+            return;
+        }
+    }
+
+    SDL_memset(CORE.PixelBuffer.pixel_buffer, 0, CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y * sizeof(Pixel));
+
+    if(CORE.Debug.view) {
+        softCountWrites(CORE.PixelBuffer.pixel_buffer, CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y, false);
+    }
+}
+
+SAPI void softClearBufferColor(Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_CLEAR_COLOR, softClearBufferColor(pixel), SOFT_RECORD_VALUE(pixel));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softClearBufferColor: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    SoftFillKernel fill = softGetFillKernel(pixel);
+    if(!fill) {
+        return;
+    }
+
+    // Clearing respects the active clip rectangle, so a panel can clear just its own viewport.
+    SoftBounds clip = softGetClipBounds();
+
+    if(softDeferCommand(SOFT_COMMAND_CLEAR, clip, false, softPixelOccludes(pixel), pixel)) {
+        return;
+    }
+
+    for(i32 y = clip.y0; y < clip.y1; y++) {
+        softFillRow(clip, y, clip.x0, clip.x1, pixel, fill);
+    }
+}
+
+SAPI i32 softScrollBuffer(i32 dx, i32 dy, Pixel fill, Rect* exposed) {
+    // Moves the content of the clip area by (dx, dy) pixels, in place. The strips it uncovers are set to [fill] as is, whatever the blend mode,
+    // so a BLANK or translucent fill doesn't leave the old pixels showing through. Their rectangles go to [exposed] (room for 2, may be NULL)
+    // and their count is returned, so only those get drawn again.
+    SOFT_RECORD_CALL_RESULT(SOFT_CALL_SCROLL, i32, softScrollBuffer(dx, dy, fill, exposed), SOFT_RECORD_VALUE(dx), SOFT_RECORD_VALUE(dy), SOFT_RECORD_VALUE(fill));
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softScrollBuffer: Pixel buffer not valid. Returning...");
+        return 0;
+    }
+
+    SoftBounds clip = softGetClipBounds();
+
+    if(softClipBoundsEmpty(clip) || (dx == 0 && dy == 0)) {
+        return 0;
+    }
+
+    i32 width = clip.x1 - clip.x0;
+    i32 height = clip.y1 - clip.y0;
+
+    // Nothing stays in view.
+    if(abs(dx) >= width || abs(dy) >= height) {
+        for(i32 y = clip.y0; y < clip.y1; y++) {
+            softFillRow(clip, y, clip.x0, clip.x1, fill, softFillSpanReplace);
+        }
+
+        if(exposed) {
+            exposed[0] = (Rect) { { clip.x0, clip.y0 }, { width, height } };
+        }
+
+        return 1;
+    }
+
+    Pixel* buffer = CORE.PixelBuffer.pixel_buffer;
+    i32 stride = CORE.PixelBuffer.size.x;
+    i32 src_x = clip.x0 + SOFT_MAX(-dx, 0);
+    i32 dst_x = clip.x0 + SOFT_MAX(dx, 0);
+    size_t row_size = (size_t)(width - abs(dx)) * sizeof(Pixel);
+
+    if(dx == 0 && width == stride) {
+        // Whole rows are contiguous: a single move.
+        i32 src_y = clip.y0 + SOFT_MAX(-dy, 0);
+        i32 dst_y = clip.y0 + SOFT_MAX(dy, 0);
+
+        memmove(&buffer[dst_y * stride], &buffer[src_y * stride], (size_t)(height - abs(dy)) * stride * sizeof(Pixel));
+    } else if(dy <= 0) {
+        // Rows go in the direction of the move, so no row is overwritten before it's read (memmove handles the overlap within a row).
+        for(i32 y = clip.y0; y < clip.y1 + dy; y++) {
+            memmove(&buffer[y * stride + dst_x], &buffer[(y - dy) * stride + src_x], row_size);
+        }
+    } else {
+        for(i32 y = clip.y1 - 1; y >= clip.y0 + dy; y--) {
+            memmove(&buffer[y * stride + dst_x], &buffer[(y - dy) * stride + src_x], row_size);
+        }
+    }
+
+    for(i32 y = clip.y0 + SOFT_MAX(dy, 0); CORE.Debug.view && y < clip.y1 + SOFT_MIN(dy, 0); y++) {
+        softCountWrites(&buffer[y * stride + dst_x], width - abs(dx), false);
+    }
+
+    // The uncovered rows span the whole width; the uncovered columns take the rest of the height.
+    Rect strips[2];
+    i32 count = 0;
+
+    if(dy != 0) {
+        strips[count++] = (Rect) { { clip.x0, dy > 0 ? clip.y0 : clip.y1 + dy }, { width, abs(dy) } };
+    }
+
+    if(dx != 0) {
+        strips[count++] = (Rect) { { dx > 0 ? clip.x0 : clip.x1 + dx, clip.y0 + SOFT_MAX(dy, 0) }, { abs(dx), height - abs(dy) } };
+    }
+
+    for(i32 i = 0; i < count; i++) {
+        for(i32 y = strips[i].position.y; y < strips[i].position.y + strips[i].size.y; y++) {
+            softFillRow(clip, y, strips[i].position.x, strips[i].position.x + strips[i].size.x, fill, softFillSpanReplace);
+        }
+
+        if(exposed) {
+            exposed[i] = strips[i];
+        }
+    }
+
+    return count;
+}
+
+SAPI void softBlit(void) {
+    softFlushDeferred();
+    softRecordFrame();
+
+    // The frame ends here even when it can't be presented (e.g. headless): the frame arena and the frame timing move on either way.
+    softFrameReset();
+    softTimeMenagement();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softBlit: Pixel data not valid. Returning...");
+        return;
+    } else if(!CORE.Render.render_texture) {
+        softLogError("softBlit: Render Texture not valid. Returning...");
+        return;
+    } else if(!CORE.Render.renderer_valid) {
+        softLogError("softBlit: Renderer not valid. Returning...");
+        return;
+    }
+
+    SDL_Rect source_rect = {
+        0,
+        0,
+        CORE.PixelBuffer.size.x,
+        CORE.PixelBuffer.size.y
+    };
+
+    SDL_Rect destination_rect = {
+        0,
+        0,
+        CORE.Window.display_size.x,
+        CORE.Window.display_size.y
+    };
+
+    // The debug views present their heatmap instead of the frame; the buffer itself is left as it is.
+    Pixel* presented = CORE.Debug.view ? softRenderDebugView() : NULL;
+
+    SDL_UpdateTexture(
+        CORE.Render.render_texture,
+        &source_rect,
+        presented ? presented : CORE.PixelBuffer.pixel_buffer, 
+        CORE.PixelBuffer.size.x * sizeof(Pixel)
+    );
+
+    SDL_RenderCopyEx(
+        CORE.Render.renderer, 
+        CORE.Render.render_texture, 
+        &source_rect, 
+        &destination_rect,
+        0.0,
+        NULL,
+        SDL_FLIP_NONE
+    );
+
+    SDL_RenderPresent(CORE.Render.renderer);
+
+    if(CORE.Debug.view) {
+        i32 pixels = SOFT_MAX(CORE.PixelBuffer.size.x * CORE.PixelBuffer.size.y, 1);
+
+        CORE.Debug.overdraw = (f32)CORE.Debug.total_writes / pixels;
+        CORE.Debug.blend_ratio = CORE.Debug.total_writes ? (f32)CORE.Debug.total_blends / CORE.Debug.total_writes : 0.0f;
+        softResetDebugCounters();
+    }
+
+    softPollEvents();
+}
+
+SAPI void softPushClipRect(Rect rect) {
+    if(CORE.Clip.count >= SOFT_CLIP_STACK_SIZE_MAX) {
+        softLogWarning("softPushClipRect: Clip stack overflow (max. %i entries). Returning...", SOFT_CLIP_STACK_SIZE_MAX);
+        return;
+    }
+
+    SoftBounds bounds = {
+        rect.position.x,
+        rect.position.y,
+        rect.position.x + rect.size.x,
+        rect.position.y + rect.size.y
+    };
+
+    // Nested clip rectangles can only shrink the visible area.
+    if(CORE.Clip.count > 0) {
+        SoftBounds top = CORE.Clip.stack[CORE.Clip.count - 1];
+
+        bounds.x0 = SOFT_MAX(bounds.x0, top.x0);
+        bounds.y0 = SOFT_MAX(bounds.y0, top.y0);
+        bounds.x1 = SOFT_MIN(bounds.x1, top.x1);
+        bounds.y1 = SOFT_MIN(bounds.y1, top.y1);
+    }
+
+    CORE.Clip.stack[CORE.Clip.count++] = bounds;
+    CORE.Camera.view_valid = false;
+}
+
+SAPI void softPopClipRect(void) {
+    if(CORE.Clip.count <= 0) {
+        softLogWarning("softPopClipRect: Clip stack is empty. Returning...");
+        return;
+    }
+
+    CORE.Clip.count--;
+    CORE.Camera.view_valid = false;
+}
+
+SAPI Rect softGetClipRect(void) {
+    SoftBounds clip = softGetClipBounds();
+
+    return (Rect) {
+        (iVec2) { clip.x0, clip.y0 },
+        (iVec2) { SOFT_MAX(clip.x1 - clip.x0, 0), SOFT_MAX(clip.y1 - clip.y0, 0) }
+    };
+}
+
+SAPI void softBeginMode2D(Camera2D camera) {
+    if(camera.zoom <= 0.0f) {
+        softLogWarning("softBeginMode2D: Invalid zoom value: %f. Defaulting to value: 1.0...", camera.zoom);
+        camera.zoom = 1.0f;
+    }
+
+    CORE.Camera.camera = camera;
+    softRotationSinCos(camera.rotation, &CORE.Camera.cos, &CORE.Camera.sin);
+
+    // Without rotation and zoom the camera is a plain integer offset, which the primitives apply directly.
+    CORE.Camera.unrotated = CORE.Camera.cos == 1.0 && CORE.Camera.sin == 0.0;
+    CORE.Camera.translation_only = CORE.Camera.unrotated && camera.zoom == 1.0f;
+    CORE.Camera.translation = softVectorSub(camera.offset, camera.target);
+
+    CORE.Camera.view_valid = false;
+    CORE.Camera.active = true;
+}
+
+SAPI void softEndMode2D(void) {
+    CORE.Camera.active = false;
+}
+
+SAPI void softBeginDeferred(void) {
+    // Clears, rectangles, images and text are queued from here on, and drawn by softEndDeferred without their hidden parts.
+    // The images and fonts they use must stay loaded (and unchanged) until then.
+    CORE.Deferred.active = true;
+}
+
+SAPI void softEndDeferred(void) {
+    softFlushDeferred();
+    CORE.Deferred.active = false;
+}
+
+SAPI iVec2 softGetWorldToScreen2D(iVec2 position, Camera2D camera) {
+    if(camera.zoom <= 0.0f) {
+        camera.zoom = 1.0f;
+    }
+
+    d32 c, s, screen_x, screen_y;
+    softRotationSinCos(camera.rotation, &c, &s);
+    softCameraToScreen(camera, c, s, position.x, position.y, &screen_x, &screen_y);
+
+    return (iVec2) { (i32)(floor(screen_x + 0.5)), (i32)(floor(screen_y + 0.5)) };
+}
+
+SAPI iVec2 softGetScreenToWorld2D(iVec2 position, Camera2D camera) {
+    if(camera.zoom <= 0.0f) {
+        camera.zoom = 1.0f;
+    }
+
+    d32 c, s, world_x, world_y;
+    softRotationSinCos(camera.rotation, &c, &s);
+    softCameraToWorld(camera, c, s, position.x + 0.5, position.y + 0.5, &world_x, &world_y);
+
+    return (iVec2) { (i32)(floor(world_x)), (i32)(floor(world_y)) };
+}
+
+SAPI void softSetDebugView(SoftDebugView view) {
+    // Counting starts with the next draw; the frame presented by the next softBlit shows what was drawn since.
+    softFlushDeferred();
+
+    if(view == DEBUG_VIEW_NONE) {
+        free(CORE.Debug.writes);
+        free(CORE.Debug.blends);
+        free(CORE.Debug.overlay);
+        memset(&CORE.Debug, 0, sizeof(CORE.Debug));
+        return;
+    }
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softSetDebugView: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(CORE.Debug.view == DEBUG_VIEW_NONE) {
+        CORE.Debug.overdraw = 0.0f;
+        CORE.Debug.blend_ratio = 0.0f;
+    }
+
+    CORE.Debug.view = view;
+    softResetDebugCounters();
+}
+
+SAPI SoftDebugView softGetDebugView(void) {
+    return CORE.Debug.view;
+}
+
+SAPI f32 softGetOverdraw(void) {
+    // Average writes per pixel of the last frame presented with a debug view on.
+    return CORE.Debug.overdraw;
+}
+
+SAPI f32 softGetBlendRatio(void) {
+    // Share of those writes that blended with the destination (the rest replaced it).
+    return CORE.Debug.blend_ratio;
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_MEMORY
+// ------------------------------------------------------
+
+SAPI void* softFrameAlloc(size_t size) {
+    size = SOFT_ARENA_ALIGN(SOFT_MAX(size, 1));
+    SoftArenaBlock* block = CORE.Arena.current;
+
+    if(!block || block->used + size > block->size) {
+        // Moves on to the next block (kept from a release) if it's big enough, or chains a new one after the current block.
+        SoftArenaBlock* next = block ? block->next : NULL;
+
+        if(next && next->size >= size) {
+            next->used = 0;
+        } else {
+            next = softArenaCreateBlock(SOFT_MAX(size, block ? block->size * 2 : SOFT_ARENA_BLOCK_SIZE), next);
+
+            if(!next) {
+                return NULL;
+            }
+
+            if(block) {
+                block->next = next;
+            } else {
+                CORE.Arena.first = next;
+            }
+        }
+
+        block = CORE.Arena.current = next;
+    }
+
+    void* result = softArenaData(block) + block->used;
+    block->used += size;
+
+    return result;
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_DRAW
+// ------------------------------------------------------
+
+SAPI void softDrawRectangle(Rect rect, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_RECTANGLE, softDrawRectangle(rect, pixel), SOFT_RECORD_VALUE(rect), SOFT_RECORD_VALUE(pixel));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawRectangle: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    SoftFillKernel fill = softGetFillKernel(pixel);
+    if(!fill) {
+        return;
+    }
+
+    SoftBounds area = { rect.position.x, rect.position.y, rect.position.x + rect.size.x, rect.position.y + rect.size.y };
+    SoftDrawCommand* command = softDeferCommand(SOFT_COMMAND_RECTANGLE, area, true, softPixelOccludes(pixel), pixel);
+
+    if(command) {
+        command->rect = rect;
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(rect.position.x, rect.position.y, rect.position.x + rect.size.x, rect.position.y + rect.size.y)) {
+            return;
+        }
+
+        // Rotated or zoomed views turn the rectangle into a general quad.
+        if(!CORE.Camera.translation_only) {
+            SoftAffineMap map = { 0 };
+            if(softBuildViewAffineMap(rect.position.x, rect.position.y, 0.0f, 0.0f, rect.size, 0.0f, 1.0f, 1.0f, &map)) {
+                softFillAffine(&map, pixel, fill);
+            }
+
+            return;
+        }
+
+        rect.position = softVectorAdd(rect.position, CORE.Camera.translation);
+    }
+
+    SoftBounds clip = softGetClipBounds();
+
+    i32 y0 = SOFT_MAX(rect.position.y, clip.y0);
+    i32 y1 = SOFT_MIN(rect.position.y + rect.size.y, clip.y1);
+
+    for(i32 y = y0; y < y1; y++) {
+        softFillRow(clip, y, rect.position.x, rect.position.x + rect.size.x, pixel, fill);
+    }
+}
+
+SAPI void softDrawRectangleLines(Rect rect, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_RECTANGLE_LINES, softDrawRectangleLines(rect, pixel), SOFT_RECORD_VALUE(rect), SOFT_RECORD_VALUE(pixel));
+
+    Line rect_lines[4]  = {
+        { (iVec2) { rect.position.x, rect.position.y }, (iVec2) { rect.position.x + rect.size.x, rect.position.y } },
+        { (iVec2) { rect.position.x, rect.position.y }, (iVec2) { rect.position.x, rect.position.y + rect.size.y} },
+        { (iVec2) { rect.position.x + rect.size.x, rect.position.y }, (iVec2) { rect.position.x + rect.size.x, rect.position.y + rect.size.y } },
+        { (iVec2) { rect.position.x, rect.position.y + rect.size.y }, (iVec2) { rect.position.x + rect.size.x, rect.position.y + rect.size.y } },
+    };
+
+    for(i32 i = 0; i < 4; i++) {
+        softDrawLine(rect_lines[i], pixel);
+    }
+}
+
+SAPI void softDrawRectangleEx(Rect rect, iVec2 pivot, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_RECTANGLE_EX, softDrawRectangleEx(rect, pivot, pixel), SOFT_RECORD_VALUE(rect), SOFT_RECORD_VALUE(pivot), SOFT_RECORD_VALUE(pixel));
+
+    softDrawRectangle(
+        (Rect) {
+            (iVec2) {
+                rect.position.x - pivot.x,
+                rect.position.y - pivot.y,
+            },
+            rect.size
+        },
+        pixel
+    );
+}
+
+SAPI void softDrawRectangleRotated(Rect rect, iVec2 pivot, f32 rotation, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_RECTANGLE_ROTATED, softDrawRectangleRotated(rect, pivot, rotation, pixel), SOFT_RECORD_VALUE(rect), SOFT_RECORD_VALUE(pivot), SOFT_RECORD_VALUE(rotation), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawRectangleRotated: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    SoftFillKernel fill = softGetFillKernel(pixel);
+    if(!fill) {
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        i32 radius = softCameraPivotRadius(rect.size, pivot);
+
+        if(softCameraCulls(rect.position.x - radius, rect.position.y - radius, rect.position.x + radius, rect.position.y + radius)) {
+            return;
+        }
+    }
+
+    // The rectangle rotates around its [pivot], which is placed at [rect.position].
+    SoftAffineMap map = { 0 };
+    if(!softBuildViewAffineMap(rect.position.x, rect.position.y, pivot.x, pivot.y, rect.size, rotation, 1.0f, 1.0f, &map)) {
+        return;
+    }
+
+    softFillAffine(&map, pixel, fill);
+}
+
+SAPI void softDrawLine(Line line, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE, softDrawLine(line, pixel), SOFT_RECORD_VALUE(line), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(SOFT_MIN(line.a.x, line.b.x), SOFT_MIN(line.a.y, line.b.y), SOFT_MAX(line.a.x, line.b.x) + 1, SOFT_MAX(line.a.y, line.b.y) + 1)) {
+            return;
+        }
+
+        // Lines stay one pixel wide; only the endpoints are transformed.
+        line.a = softCameraPoint(line.a);
+        line.b = softCameraPoint(line.b);
+    }
+
+    softDrawLineSegment(softGetClipBounds(), line, pixel, false);
+}
+
+SAPI void softDrawLineStrip(const iVec2* points, i32 count, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_STRIP, softDrawLineStrip(points, count, pixel), softRecordPoints(points, count), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!points || count < 1) {
+        return;
+    }
+
+    SoftPolyline polyline = { 0 };
+    softPolylineBegin(&polyline, CORE.Camera.active ? softCameraPoint(points[0]) : points[0], pixel);
+
+    for(i32 i = 1; i < count; i++) {
+        softPolylineTo(&polyline, CORE.Camera.active ? softCameraPoint(points[i]) : points[i]);
+    }
+}
+
+SAPI void softDrawLineAA(Line line, Pixel pixel) {
+    // Source: https://en.wikipedia.org/wiki/Xiaolin_Wu%27s_line_algorithm
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_AA, softDrawLineAA(line, pixel), SOFT_RECORD_VALUE(line), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawLineAA: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!softGetFillKernel(pixel)) {
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(SOFT_MIN(line.a.x, line.b.x), SOFT_MIN(line.a.y, line.b.y), SOFT_MAX(line.a.x, line.b.x) + 1, SOFT_MAX(line.a.y, line.b.y) + 1)) {
+            return;
+        }
+
+        line.a = softCameraPoint(line.a);
+        line.b = softCameraPoint(line.b);
+    }
+
+    // The second pixel of every step can reach one row / column further.
+    SoftBounds clip = softGetClipBounds();
+    if(softClipRejects(clip, SOFT_MIN(line.a.x, line.b.x), SOFT_MIN(line.a.y, line.b.y), SOFT_MAX(line.a.x, line.b.x) + 2, SOFT_MAX(line.a.y, line.b.y) + 2)) {
+        return;
+    }
+
+    // Steep lines are walked along y: the axes (of the line and of the walked range) are swapped.
+    bool steep = abs(line.b.y - line.a.y) > abs(line.b.x - line.a.x);
+    SoftBounds range = clip;
+
+    if(steep) {
+        line.a = (iVec2) { line.a.y, line.a.x };
+        line.b = (iVec2) { line.b.y, line.b.x };
+        range = (SoftBounds) { clip.y0, clip.x0, clip.y1, clip.x1 };
+    }
+
+    if(line.a.x > line.b.x) {
+        Line swapped = { line.b, line.a };
+        line = swapped;
+    }
+
+    i32 dx = line.b.x - line.a.x;
+    i32 dy = line.b.y - line.a.y;
+
+    // The minor coordinate is a 32.32 fixed-point value; its top 8 fractional bits split the coverage between the two pixels.
+    i64 gradient = dx == 0 ? 0 : softFloorDiv((i64)(dy) * SOFT_FIXED_ONE + dx / 2, dx);
+
+    i32 x_first = SOFT_MAX(line.a.x, range.x0);
+    i32 x_last = SOFT_MIN(line.b.x, range.x1 - 1);
+    i64 y = (i64)(line.a.y) * SOFT_FIXED_ONE + (i64)(x_first - line.a.x) * gradient;
+
+    SoftCoverageBrush brush = softGetCoverageBrush(pixel);
+
+    for(i32 x = x_first; x <= x_last; x++, y += gradient) {
+        i32 row = (i32)(y >> SOFT_FIXED_SHIFT);
+        u32 fraction = (u32)((y >> (SOFT_FIXED_SHIFT - 8)) & 0xFF);
+
+        if(steep) {
+            softCoveragePixel(clip, row, x, 255 - fraction, &brush);
+            softCoveragePixel(clip, row + 1, x, fraction, &brush);
+        } else {
+            softCoveragePixel(clip, x, row, 255 - fraction, &brush);
+            softCoveragePixel(clip, x, row + 1, fraction, &brush);
+        }
+    }
+}
+
+SAPI void softDrawLineBezier(iVec2 start, iVec2 end, iVec2 midpoint, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_BEZIER, softDrawLineBezier(start, end, midpoint, pixel), SOFT_RECORD_VALUE(start), SOFT_RECORD_VALUE(end), SOFT_RECORD_VALUE(midpoint), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    const iVec2 points[3] = { start, midpoint, end };
+
+    softDrawBezier(points, 2, pixel);
+}
+
+SAPI void softDrawLineBezierCubic(iVec2 start, iVec2 end, iVec2 control_start, iVec2 control_end, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_BEZIER_CUBIC, softDrawLineBezierCubic(start, end, control_start, control_end, pixel), SOFT_RECORD_VALUE(start), SOFT_RECORD_VALUE(end), SOFT_RECORD_VALUE(control_start), SOFT_RECORD_VALUE(control_end), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    const iVec2 points[4] = { start, control_start, control_end, end };
+
+    softDrawBezier(points, 3, pixel);
+}
+
+SAPI void softDrawCircle(Circle circle, Pixel pixel) {
+    // Source: https://youtu.be/LmQKZmQh1ZQ?list=PLpM-Dvs8t0Va-Gb0Dp4d9t8yvNFHaKH6N&t=3088
+    SOFT_RECORD_CALL(SOFT_CALL_CIRCLE, softDrawCircle(circle, pixel), SOFT_RECORD_VALUE(circle), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawCircle: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    SoftFillKernel fill = softGetFillKernel(pixel);
+    if(!fill || circle.r <= 0) {
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r, circle.position.y + circle.r)) {
+            return;
+        }
+
+        circle.position = softCameraPoint(circle.position);
+        circle.r = (i32)(floor(circle.r * CORE.Camera.camera.zoom + 0.5f));
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    if(softClipRejects(clip, circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r, circle.position.y + circle.r)) {
+        return;
+    }
+
+    // Every row of the circle is a single span: x_delta^2 + y_delta^2 <= r^2.
+    // The half-width of the span changes by small steps between the rows, so it's tracked incrementally instead of calling sqrt.
+    i32 r = circle.r;
+    i32 half_width = 0;
+
+    // Rows outside of the clip rectangle are skipped; the half-width is computed directly for the first visible row.
+    i32 y_start = SOFT_MAX(-r, clip.y0 - circle.position.y);
+    i32 y_end = SOFT_MIN(r, clip.y1 - circle.position.y);
+
+    if(y_start > -r) {
+        half_width = softSqrtI(r * r - y_start * y_start);
+    }
+
+    for(i32 y_delta = y_start; y_delta < y_end; y_delta++) {
+        i32 remainder = r * r - y_delta * y_delta;
+
+        while((half_width + 1) * (half_width + 1) <= remainder) {
+            half_width++;
+        }
+
+        while(half_width * half_width > remainder) {
+            half_width--;
+        }
+
+        softFillRow(
+            clip,
+            circle.position.y + y_delta, 
+            circle.position.x - half_width, 
+            circle.position.x + SOFT_MIN(half_width, r - 1) + 1, 
+            pixel, 
+            fill
+        );
+    }
+}
+
+SAPI void softDrawCircleLines(Circle circle, Pixel pixel) {
+    // Source: https://zingl.github.io/bresenham.html
+    SOFT_RECORD_CALL(SOFT_CALL_CIRCLE_LINES, softDrawCircleLines(circle, pixel), SOFT_RECORD_VALUE(circle), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r + 1, circle.position.y + circle.r + 1)) {
+            return;
+        }
+
+        circle.position = softCameraPoint(circle.position);
+        circle.r = (i32)(floor(circle.r * CORE.Camera.camera.zoom + 0.5f));
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    if(softClipRejects(clip, circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r + 1, circle.position.y + circle.r + 1)) {
+        return;
+    }
+
+    i32 r = circle.r;
+    i32 x = r * -1;
+    i32 y = 0; 
+    i32 err = 2 - 2 * r; 
+
+    do {
+        softSetPixel(clip, circle.position.x - x, circle.position.y + y, pixel);
+        softSetPixel(clip, circle.position.x - y, circle.position.y - x, pixel);
+        softSetPixel(clip, circle.position.x + x, circle.position.y - y, pixel);
+        softSetPixel(clip, circle.position.x + y, circle.position.y + x, pixel);
+
+        r = err;
+
+        if (r <= y) {
+            err += ++y * 2 + 1;
+        }
+
+        if (r > x || err > y) {
+            err += ++x * 2 + 1;
+        }
+    } while (x < 0);
+}
+
+SAPI void softDrawCircleAA(Circle circle, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_CIRCLE_AA, softDrawCircleAA(circle, pixel), SOFT_RECORD_VALUE(circle), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawCircleAA: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    SoftFillKernel fill = softGetFillKernel(pixel);
+    if(!fill || circle.r <= 0) {
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r, circle.position.y + circle.r)) {
+            return;
+        }
+
+        circle.position = softCameraPoint(circle.position);
+        circle.r = (i32)(floor(circle.r * CORE.Camera.camera.zoom + 0.5f));
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    if(softClipRejects(clip, circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r, circle.position.y + circle.r)) {
+        return;
+    }
+
+    // Doubled coordinates: like softDrawCircle, the circle is centered on the corner [position], so the pixel centers sit at odd offsets.
+    // Pixels inside of the radius (2r - 1) are fully covered and go through the fill kernel; only the band up to (2r + 1) needs coverage.
+    i64 r = circle.r;
+    i64 outer = (2 * r + 1) * (2 * r + 1);
+    i64 inner = (2 * r - 1) * (2 * r - 1);
+    i64 scale = softCeilDiv((i64)(255) << 16, outer - inner);
+
+    SoftCoverageBrush brush = softGetCoverageBrush(pixel);
+
+    i32 y_start = SOFT_MAX(-circle.r, clip.y0 - circle.position.y);
+    i32 y_end = SOFT_MIN(circle.r, clip.y1 - circle.position.y);
+
+    i64 outer_root = softFloorSqrt(outer - 1 - (2 * y_start + 1) * (2 * y_start + 1));
+    i64 inner_root = softFloorSqrt(inner - (2 * y_start + 1) * (2 * y_start + 1));
+
+    for(i32 y_delta = y_start; y_delta < y_end; y_delta++) {
+        i32 y = circle.position.y + y_delta;
+        i64 dy = 2 * y_delta + 1;
+
+        outer_root = softRefineSqrt(outer - 1 - dy * dy, outer_root);
+        inner_root = softRefineSqrt(inner - dy * dy, inner_root);
+
+        // Number of pixels on each side of the center that are touched / fully covered.
+        i32 outer_half = (i32)((outer_root + 1) / 2);
+        i32 inner_half = inner >= dy * dy ? (i32)((inner_root + 1) / 2) : 0;
+
+        i32 x_center = circle.position.x;
+
+        softCircleCoverageRow(clip, y, x_center - outer_half, x_center - inner_half, -2 * outer_half + 1, dy * dy, outer, scale, false, &brush);
+        softFillRow(clip, y, x_center - inner_half, x_center + inner_half, pixel, fill);
+        softCircleCoverageRow(clip, y, x_center + inner_half, x_center + outer_half, 2 * inner_half + 1, dy * dy, outer, scale, false, &brush);
+    }
+}
+
+SAPI void softDrawCircleLinesAA(Circle circle, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_CIRCLE_LINES_AA, softDrawCircleLinesAA(circle, pixel), SOFT_RECORD_VALUE(circle), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawCircleLinesAA: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!softGetFillKernel(pixel) || circle.r < 0) {
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r + 1, circle.position.y + circle.r + 1)) {
+            return;
+        }
+
+        circle.position = softCameraPoint(circle.position);
+        circle.r = (i32)(floor(circle.r * CORE.Camera.camera.zoom + 0.5f));
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    if(softClipRejects(clip, circle.position.x - circle.r, circle.position.y - circle.r, circle.position.x + circle.r + 1, circle.position.y + circle.r + 1)) {
+        return;
+    }
+
+    SoftCoverageBrush brush = softGetCoverageBrush(pixel);
+
+    if(circle.r == 0) {
+        softCoveragePixel(clip, circle.position.x, circle.position.y, 255, &brush);
+        return;
+    }
+
+    // Doubled coordinates: like softDrawCircleLines, the ring is centered on the pixel [position], so the pixel centers sit at even offsets.
+    // The coverage falls off linearly within a pixel on both sides of the radius (2r), which keeps the ring one pixel thick.
+    i64 r = circle.r;
+    i64 radius = 4 * r * r;
+    i64 band = 8 * r;
+    i64 scale = softCeilDiv((i64)(255) << 16, band);
+
+    i32 y_start = SOFT_MAX(-circle.r, clip.y0 - circle.position.y);
+    i32 y_end = SOFT_MIN(circle.r + 1, clip.y1 - circle.position.y);
+
+    i64 outer_root = softFloorSqrt(radius + band - 1 - 4 * (i64)(y_start) * y_start);
+    i64 inner_root = softFloorSqrt(radius - band - 4 * (i64)(y_start) * y_start);
+
+    for(i32 y_delta = y_start; y_delta < y_end; y_delta++) {
+        i32 y = circle.position.y + y_delta;
+        i64 dy = 2 * y_delta;
+
+        outer_root = softRefineSqrt(radius + band - 1 - dy * dy, outer_root);
+        inner_root = softRefineSqrt(radius - band - dy * dy, inner_root);
+
+        // Pixels on each side of the center that are touched by the ring / that are inside of the ring's hole.
+        i32 outer_half = (i32)(outer_root / 2);
+        i32 x_center = circle.position.x;
+
+        if(radius - band < dy * dy) {
+            softCircleCoverageRow(clip, y, x_center - outer_half, x_center + outer_half + 1, -2 * outer_half, dy * dy, radius, scale, true, &brush);
+            continue;
+        }
+
+        i32 inner_half = (i32)(inner_root / 2);
+
+        softCircleCoverageRow(clip, y, x_center - outer_half, x_center - inner_half, -2 * outer_half, dy * dy, radius, scale, true, &brush);
+        softCircleCoverageRow(clip, y, x_center + inner_half + 1, x_center + outer_half + 1, 2 * (inner_half + 1), dy * dy, radius, scale, true, &brush);
+    }
+}
+
+SAPI void softDrawTriangle(Triangle triangle, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_TRIANGLE, softDrawTriangle(triangle, pixel), SOFT_RECORD_VALUE(triangle), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawTriangle: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    SoftTriangleShader shader = { 0 };
+    shader.pixel = pixel;
+    shader.fill = softGetFillKernel(pixel);
+
+    if(!shader.fill || !softCameraTriangle(&triangle)) {
+        return;
+    }
+
+    SoftTriangleSetup setup = { 0 };
+    if(softSetupTriangle(triangle, softGetClipBounds(), &setup)) {
+        softRasterizeTriangle(&setup, softTriangleSpanFlat, &shader);
+    }
+}
+
+SAPI void softDrawTriangleLines(Triangle triangle, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_TRIANGLE_LINES, softDrawTriangleLines(triangle, pixel), SOFT_RECORD_VALUE(triangle), SOFT_RECORD_VALUE(pixel));
+
+    softDrawLine((Line) { triangle.a, triangle.b }, pixel);
+    softDrawLine((Line) { triangle.b, triangle.c }, pixel);
+    softDrawLine((Line) { triangle.c, triangle.a }, pixel);
+}
+
+SAPI void softDrawTriangleColors(Triangle triangle, Pixel pixel_a, Pixel pixel_b, Pixel pixel_c) {
+    SOFT_RECORD_CALL(SOFT_CALL_TRIANGLE_COLORS, softDrawTriangleColors(triangle, pixel_a, pixel_b, pixel_c), SOFT_RECORD_VALUE(triangle), SOFT_RECORD_VALUE(pixel_a), SOFT_RECORD_VALUE(pixel_b), SOFT_RECORD_VALUE(pixel_c));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawTriangleColors: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!softCameraTriangle(&triangle)) {
+        return;
+    }
+
+    SoftTriangleSetup setup = { 0 };
+    if(!softSetupTriangle(triangle, softGetClipBounds(), &setup)) {
+        return;
+    }
+
+    SoftTriangleShader shader = { 0 };
+    shader.copy = softGetCopyKernel();
+
+    for(i32 c = 0; c < 4; c++) {
+        i32 shift = c * 8;
+
+        softTrianglePlane(&setup, (pixel_a >> shift) & 0xFF, (pixel_b >> shift) & 0xFF, (pixel_c >> shift) & 0xFF, 65536.0, shader.channels[c]);
+    }
+
+    softRasterizeTriangle(&setup, softTriangleSpanColors, &shader);
+}
+
+SAPI void softDrawTriangleTextured(Triangle triangle, Image* image, iVec2 uv_a, iVec2 uv_b, iVec2 uv_c, Pixel tint) {
+    SOFT_RECORD_CALL(SOFT_CALL_TRIANGLE_TEXTURED, softDrawTriangleTextured(triangle, image, uv_a, uv_b, uv_c, tint), SOFT_RECORD_VALUE(triangle), softRecordImage(image), SOFT_RECORD_VALUE(uv_a), SOFT_RECORD_VALUE(uv_b), SOFT_RECORD_VALUE(uv_c), SOFT_RECORD_VALUE(tint));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawTriangleTextured: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!image || !image->data || !softCameraTriangle(&triangle)) {
+        return;
+    }
+
+    SoftTriangleSetup setup = { 0 };
+    if(!softSetupTriangle(triangle, softGetClipBounds(), &setup)) {
+        return;
+    }
+
+    // NOTE: Texture coordinates are given in pixels of the [image].
+    SoftTriangleShader shader = { 0 };
+    shader.copy = softGetCopyKernel();
+    shader.image = image;
+    shader.tint = tint;
+
+    softTrianglePlane(&setup, uv_a.x, uv_b.x, uv_c.x, (d32)(SOFT_FIXED_ONE), shader.u);
+    softTrianglePlane(&setup, uv_a.y, uv_b.y, uv_c.y, (d32)(SOFT_FIXED_ONE), shader.v);
+
+    softRasterizeTriangle(&setup, softTriangleSpanTextured, &shader);
+}
+
+SAPI void softDrawPolygon(const iVec2* points, i32 count, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_POLYGON, softDrawPolygon(points, count, pixel), softRecordPoints(points, count), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawPolygon: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!points || count < 3 || !softGetFillKernel(pixel) || softCameraCullsPoints(points, count, 0)) {
+        return;
+    }
+
+    SoftArenaMark mark = softFrameMark();
+    SoftPoint* view = (SoftPoint*)softFrameAlloc(count * sizeof(SoftPoint));
+
+    if(!view) {
+        return;
+    }
+
+    for(i32 i = 0; i < count; i++) {
+        view[i] = softViewPoint(points[i].x, points[i].y);
+    }
+
+    SoftPath path = { 0 };
+    softPathBegin(&path, count);
+    softPathAddContour(&path, view, count, 0);
+    softPathFill(&path, CORE.Config.fill_rule, pixel);
+
+    softFrameRelease(mark);
+}
+
+SAPI void softDrawLineStroke(Line line, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_STROKE, softDrawLineStroke(line, width, pixel), SOFT_RECORD_VALUE(line), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawLineStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    const iVec2 points[2] = { line.a, line.b };
+
+    softStrokePoints(points, 2, false, width, pixel);
+}
+
+SAPI void softDrawLineStripStroke(const iVec2* points, i32 count, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_STRIP_STROKE, softDrawLineStripStroke(points, count, width, pixel), softRecordPoints(points, count), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawLineStripStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    softStrokePoints(points, count, false, width, pixel);
+}
+
+SAPI void softDrawLineBezierStroke(iVec2 start, iVec2 end, iVec2 midpoint, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_BEZIER_STROKE, softDrawLineBezierStroke(start, end, midpoint, width, pixel), SOFT_RECORD_VALUE(start), SOFT_RECORD_VALUE(end), SOFT_RECORD_VALUE(midpoint), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawLineBezierStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    const iVec2 control[3] = { start, midpoint, end };
+
+    softStrokeBezier(control, 2, width, pixel);
+}
+
+SAPI void softDrawLineBezierCubicStroke(iVec2 start, iVec2 end, iVec2 control_start, iVec2 control_end, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_LINE_BEZIER_CUBIC_STROKE, softDrawLineBezierCubicStroke(start, end, control_start, control_end, width, pixel), SOFT_RECORD_VALUE(start), SOFT_RECORD_VALUE(end), SOFT_RECORD_VALUE(control_start), SOFT_RECORD_VALUE(control_end), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawLineBezierCubicStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    const iVec2 control[4] = { start, control_start, control_end, end };
+
+    softStrokeBezier(control, 3, width, pixel);
+}
+
+SAPI void softDrawPolygonStroke(const iVec2* points, i32 count, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_POLYGON_STROKE, softDrawPolygonStroke(points, count, width, pixel), softRecordPoints(points, count), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawPolygonStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    softStrokePoints(points, count, true, width, pixel);
+}
+
+SAPI void softDrawRectangleStroke(Rect rect, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_RECTANGLE_STROKE, softDrawRectangleStroke(rect, width, pixel), SOFT_RECORD_VALUE(rect), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawRectangleStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(rect.size.x <= 0 || rect.size.y <= 0 || !(width > 0.0f) || !softGetFillKernel(pixel)) {
+        return;
+    }
+
+    // The stroke stays inside of the rectangle (like softDrawRectangleLines); a wide one covers all of it.
+    if(2.0f * width >= SOFT_MIN(rect.size.x, rect.size.y)) {
+        softDrawRectangle(rect, pixel);
+        return;
+    }
+
+    if(CORE.Camera.active && softCameraCulls(rect.position.x, rect.position.y, rect.position.x + rect.size.x, rect.position.y + rect.size.y)) {
+        return;
+    }
+
+    d32 half = width / 2.0;
+    d32 x0 = rect.position.x + half;
+    d32 y0 = rect.position.y + half;
+    d32 x1 = rect.position.x + rect.size.x - half;
+    d32 y1 = rect.position.y + rect.size.y - half;
+
+    SoftPoint corners[4] = { softViewPoint(x0, y0), softViewPoint(x1, y0), softViewPoint(x1, y1), softViewPoint(x0, y1) };
+
+    SoftPath path = { 0 };
+    softPathBegin(&path, 32);
+    softPathAddStroke(&path, corners, 4, true, softViewLength(width));
+    softPathFill(&path, FILL_NONZERO, pixel);
+}
+
+SAPI void softDrawCircleStroke(Circle circle, f32 width, Pixel pixel) {
+    SOFT_RECORD_CALL(SOFT_CALL_CIRCLE_STROKE, softDrawCircleStroke(circle, width, pixel), SOFT_RECORD_VALUE(circle), SOFT_RECORD_VALUE(width), SOFT_RECORD_VALUE(pixel));
+
+    softFlushDeferred();
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawCircleStroke: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(circle.r < 0 || !(width > 0.0f) || !softGetFillKernel(pixel)) {
+        return;
+    }
+
+    i32 margin = circle.r + (i32)(ceilf(width));
+
+    if(CORE.Camera.active && softCameraCulls(circle.position.x - margin, circle.position.y - margin, circle.position.x + margin + 1, circle.position.y + margin + 1)) {
+        return;
+    }
+
+    // A ring: the outer contour adds to the winding and the inner one cancels it out.
+    SoftPoint center = softViewPoint(circle.position.x + 0.5, circle.position.y + 0.5);
+    d32 radius = softViewLength(circle.r);
+    d32 half = softViewLength(width) / 2.0;
+
+    SoftPath path = { 0 };
+    softPathBegin(&path, 2 * softCircleSegments(radius + half));
+    softPathAddCircle(&path, center, radius + half, 1);
+
+    if(radius > half) {
+        softPathAddCircle(&path, center, radius - half, -1);
+    }
+
+    softPathFill(&path, FILL_NONZERO, pixel);
+}
+
+SAPI void softDrawText(const string text, iVec2 position, i32 size, Pixel tint) {
+    Font* font = softGetDefaultFont(size);
+
+    if(font) {
+        softDrawTextEx(font, text, position, tint);
+    }
+}
+
+SAPI void softDrawTextEx(Font* font, const string text, iVec2 position, Pixel tint) {
+    SOFT_RECORD_CALL(SOFT_CALL_TEXT, softDrawTextEx(font, text, position, tint), softRecordFont(font), softRecordText(text), SOFT_RECORD_VALUE(position), SOFT_RECORD_VALUE(tint));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawTextEx: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!font || !font->atlas || !text || !softGetFillKernel(tint)) {
+        return;
+    }
+
+    // Deferred: the text is copied for the rest of the frame, and a line of margin around it covers the glyph offsets.
+    if(softDeferring()) {
+        iVec2 anchor = CORE.Camera.active ? softCameraPoint(position) : position;
+        iVec2 extent = softMeasureTextEx(font, text);
+        i32 margin = font->line_height;
+
+        SoftBounds area = { anchor.x - margin, anchor.y - margin, anchor.x + extent.x + margin, anchor.y + extent.y + margin };
+        char* copy = (char*)softFrameAlloc(strlen(text) + 1);
+        SoftDrawCommand* command = copy ? softDeferCommand(SOFT_COMMAND_TEXT, area, false, false, tint) : NULL;
+
+        if(command) {
+            strcpy(copy, text);
+            command->text.font = font;
+            command->text.text = copy;
+            command->text.position = position;
+            return;
+        }
+    }
+
+    // Text isn't transformed by the camera: it's anchored at the mapped [position] and stays upright and unscaled.
+    if(CORE.Camera.active) {
+        position = softCameraPoint(position);
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    SoftCoverageBrush brush = softGetCoverageBrush(tint);
+    iVec2 pen = position;
+
+    for(const char* c = text; *c; c++) {
+        if(*c == '\n') {
+            pen = (iVec2) { position.x, pen.y + font->line_height };
+            continue;
+        }
+
+        // Lines above or below the clip area are skipped as a whole.
+        if(pen.y >= clip.y1) {
+            break;
+        }
+
+        if(pen.y + font->line_height <= clip.y0) {
+            for(; c[1] && c[1] != '\n'; c++);
+            continue;
+        }
+
+        i32 index = (u8)(*c) - SOFT_FONT_GLYPH_FIRST;
+        const Glyph* glyph = &font->glyphs[(index >= 0 && index < SOFT_FONT_GLYPH_COUNT) ? index : '?' - SOFT_FONT_GLYPH_FIRST];
+
+        softDrawGlyph(font, glyph, pen.x, pen.y, clip, &brush);
+        pen.x += glyph->advance;
+    }
+}
+
+SAPI void softDrawImage(Image* image, iVec2 position, Pixel tint) {
+    softDrawImageEx(image, position, softVectorZero(), FLIP_DEFAULT, tint);
+}
+
+SAPI void softDrawImageEx(Image* image, iVec2 position, iVec2 pivot, SoftImageFlip image_flip, Pixel tint) {
+    SOFT_RECORD_CALL(SOFT_CALL_IMAGE, softDrawImageEx(image, position, pivot, image_flip, tint), softRecordImage(image), SOFT_RECORD_VALUE(position), SOFT_RECORD_VALUE(pivot), SOFT_RECORD_VALUE(image_flip), SOFT_RECORD_VALUE(tint));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawImageEx: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!image || !image->data) {
+        return;
+    }
+
+    if(image_flip < FLIP_DEFAULT || image_flip > FLIP_HV) {
+        softLogWarning("Invalid flip value: %i. Defaulting to value: 0 (FLIP_DEFAULT)...", image_flip);
+        image_flip = FLIP_DEFAULT;
+    }
+
+    SoftBounds area = { position.x - pivot.x, position.y - pivot.y, position.x - pivot.x + image->size.x, position.y - pivot.y + image->size.y };
+    SoftDrawCommand* command = softDeferCommand(SOFT_COMMAND_IMAGE, area, true, softImageOccludes(image, 0, image->size.y, tint), tint);
+
+    if(command) {
+        command->image.image = *image;
+        command->image.dest.position = position;
+        command->image.pivot = pivot;
+        command->image.flip = image_flip;
+        return;
+    }
+
+    bool flip_h = image_flip == FLIP_H || image_flip == FLIP_HV;
+    bool flip_v = image_flip == FLIP_V || image_flip == FLIP_HV;
+
+    if(CORE.Camera.active) {
+        iVec2 world_origin = softVectorSub(position, pivot);
+
+        if(softCameraCulls(world_origin.x, world_origin.y, world_origin.x + image->size.x, world_origin.y + image->size.y)) {
+            return;
+        }
+
+        // Rotated or zoomed views go through the affine mapper.
+        // A flip mirrors the local space: the scale turns negative and the pivot moves to the other side of the image.
+        if(!CORE.Camera.translation_only) {
+            SoftAffineMap map = { 0 };
+            if(softBuildViewAffineMap(
+                position.x, 
+                position.y, 
+                flip_h ? image->size.x - pivot.x : pivot.x, 
+                flip_v ? image->size.y - pivot.y : pivot.y, 
+                image->size, 
+                0.0f, 
+                flip_h ? -1.0f : 1.0f, 
+                flip_v ? -1.0f : 1.0f, 
+                &map)) {
+                softDrawImageAffine(image, (Rect) { softVectorZero(), image->size }, &map, tint);
+            }
+
+            return;
+        }
+
+        position = softVectorAdd(position, CORE.Camera.translation);
+    }
+
+    iVec2 origin = softVectorSub(position, pivot);
+
+    // Clip the destination area once, so the rows below can be blended without any per-pixel checks.
+    SoftBounds clip = softGetClipBounds();
+
+    i32 x0 = SOFT_MAX(origin.x, clip.x0);
+    i32 y0 = SOFT_MAX(origin.y, clip.y0);
+    i32 x1 = SOFT_MIN(origin.x + image->size.x, clip.x1);
+    i32 y1 = SOFT_MIN(origin.y + image->size.y, clip.y1);
+
+    if(x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    // Run encoded images skip their transparent runs (mirrored rows are blended as a whole).
+    if(image->runs && !flip_h) {
+        softDrawImageRuns(image, origin, x0, y0, x1, y1, flip_v, tint);
+        return;
+    }
+
+    SoftCopyKernel copy = softGetCopyKernel();
+    bool tinted = !softPixelCompare(tint, WHITE);
+    Pixel row[SOFT_SPAN_CHUNK_SIZE];
+
+    for(i32 y = y0; y < y1; y++) {
+        i32 src_y = flip_v ? image->size.y - 1 - (y - origin.y) : y - origin.y;
+
+        Pixel* dst = &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x];
+        const Pixel* src = &image->data[src_y * image->size.x];
+
+        if(!flip_h && !tinted) {
+            copy(dst + x0, src + (x0 - origin.x), x1 - x0);
+            continue;
+        }
+
+        // Flipped or tinted rows go through a small stack buffer first.
+        for(i32 x = x0; x < x1; x += SOFT_SPAN_CHUNK_SIZE) {
+            i32 count = SOFT_MIN(SOFT_SPAN_CHUNK_SIZE, x1 - x);
+
+            if(flip_h) {
+                i32 src_x = image->size.x - 1 - (x - origin.x);
+
+                for(i32 i = 0; i < count; i++) {
+                    row[i] = src[src_x - i];
+                }
+            } else {
+                memcpy(row, src + (x - origin.x), count * sizeof(Pixel));
+            }
+
+            if(tinted) {
+                softTintSpan(row, row, count, tint);
+            }
+
+            copy(dst + x, row, count);
+        }
+    }
+}
+
+SAPI void softDrawImageRotated(Image* image, iVec2 position, iVec2 pivot, f32 rotation, Pixel tint) {
+    SOFT_RECORD_CALL(SOFT_CALL_IMAGE_ROTATED, softDrawImageRotated(image, position, pivot, rotation, tint), softRecordImage(image), SOFT_RECORD_VALUE(position), SOFT_RECORD_VALUE(pivot), SOFT_RECORD_VALUE(rotation), SOFT_RECORD_VALUE(tint));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawImageRotated: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!image || !image->data) {
+        return;
+    }
+
+    // No rotation at all: the regular blit copies whole rows.
+    if(fmod(rotation, 360.0) == 0.0) {
+        softDrawImageEx(image, position, pivot, FLIP_DEFAULT, tint);
+        return;
+    }
+
+    softFlushDeferred();
+
+    if(CORE.Camera.active) {
+        i32 radius = softCameraPivotRadius(image->size, pivot);
+
+        if(softCameraCulls(position.x - radius, position.y - radius, position.x + radius, position.y + radius)) {
+            return;
+        }
+    }
+
+    // The image rotates around its [pivot], which is placed at [position].
+    SoftAffineMap map = { 0 };
+    if(!softBuildViewAffineMap(position.x, position.y, pivot.x, pivot.y, image->size, rotation, 1.0f, 1.0f, &map)) {
+        return;
+    }
+
+    softDrawImageAffine(image, (Rect) { softVectorZero(), image->size }, &map, tint);
+}
+
+SAPI void softDrawImagePro(Image* image, Rect source, Rect dest, Pixel tint) {
+    SOFT_RECORD_CALL(SOFT_CALL_IMAGE_PRO, softDrawImagePro(image, source, dest, tint), softRecordImage(image), SOFT_RECORD_VALUE(source), SOFT_RECORD_VALUE(dest), SOFT_RECORD_VALUE(tint));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawImagePro: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!image || !image->data) {
+        return;
+    }
+
+    // NOTE: Negative source size flips the image along that axis.
+    if(source.size.x == 0 || source.size.y == 0 || dest.size.x <= 0 || dest.size.y <= 0) {
+        return;
+    }
+
+    // Every destination pixel is written only when the source stays inside the image.
+    i32 source_x0 = SOFT_MIN(source.position.x, source.position.x + source.size.x);
+    i32 source_y0 = SOFT_MIN(source.position.y, source.position.y + source.size.y);
+    i32 source_x1 = SOFT_MAX(source.position.x, source.position.x + source.size.x);
+    i32 source_y1 = SOFT_MAX(source.position.y, source.position.y + source.size.y);
+
+    bool inside = source_x0 >= 0 && source_y0 >= 0 && source_x1 <= image->size.x && source_y1 <= image->size.y;
+    SoftBounds area = { dest.position.x, dest.position.y, dest.position.x + dest.size.x, dest.position.y + dest.size.y };
+    SoftDrawCommand* command = softDeferCommand(SOFT_COMMAND_IMAGE_PRO, area, true, inside && softImageOccludes(image, source_y0, source_y1, tint), tint);
+
+    if(command) {
+        command->image.image = *image;
+        command->image.source = source;
+        command->image.dest = dest;
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(dest.position.x, dest.position.y, dest.position.x + dest.size.x, dest.position.y + dest.size.y)) {
+            return;
+        }
+
+        if(!CORE.Camera.unrotated) {
+            softDrawImageProRotatedView(image, source, dest, tint);
+            return;
+        }
+
+        // Without rotation the destination stays an axis-aligned rectangle, so the regular scaler (and its filtering) still applies.
+        iVec2 corner_min = softCameraPoint(dest.position);
+        iVec2 corner_max = softCameraPoint(softVectorAdd(dest.position, dest.size));
+
+        dest = (Rect) { corner_min, softVectorSub(corner_max, corner_min) };
+        if(dest.size.x <= 0 || dest.size.y <= 0) {
+            return;
+        }
+    }
+
+    SoftBounds clip = softGetClipBounds();
+    if(softClipRejects(clip, dest.position.x, dest.position.y, dest.position.x + dest.size.x, dest.position.y + dest.size.y)) {
+        return;
+    }
+
+    SoftAxisMap map_x = { 0 };
+    SoftAxisMap map_y = { 0 };
+
+    if(!softMapAxis(dest.position.x, dest.size.x, source.position.x, source.size.x, image->size.x, clip.x0, clip.x1, &map_x) ||
+       !softMapAxis(dest.position.y, dest.size.y, source.position.y, source.size.y, image->size.y, clip.y0, clip.y1, &map_y)) {
+        return;
+    }
+
+    // Unscaled draws have nothing to filter.
+    bool scaled = abs(source.size.x) != dest.size.x || abs(source.size.y) != dest.size.y;
+
+    if(scaled && CORE.Config.image_filter == FILTER_BILINEAR) {
+        softDrawImageBilinear(image, dest, map_x, map_y, tint);
+    } else {
+        softDrawImageNearest(image, dest, map_x, map_y, tint);
+    }
+}
+
+SAPI void softDrawImageRec(Image* image, Rect source, iVec2 position, Pixel tint) {
+    // Unscaled blit of the [source] region (i.e. a sprite sheet frame), straight from the image rows.
+    SOFT_RECORD_CALL(SOFT_CALL_IMAGE_REC, softDrawImageRec(image, source, position, tint), softRecordImage(image), SOFT_RECORD_VALUE(source), SOFT_RECORD_VALUE(position), SOFT_RECORD_VALUE(tint));
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawImageRec: Pixel buffer not valid. Returning...");
+        return;
+    }
+
+    if(!image || !image->data) {
+        return;
+    }
+
+    // Flipped regions and transformed views go through the scaler.
+    if(source.size.x < 0 || source.size.y < 0 || (CORE.Camera.active && !CORE.Camera.translation_only)) {
+        softDrawImagePro(image, source, (Rect) { position, { abs(source.size.x), abs(source.size.y) } }, tint);
+        return;
+    }
+
+    SoftBounds area = {
+        SOFT_MAX(position.x, position.x - source.position.x), 
+        SOFT_MAX(position.y, position.y - source.position.y), 
+        SOFT_MIN(position.x + source.size.x, position.x - source.position.x + image->size.x), 
+        SOFT_MIN(position.y + source.size.y, position.y - source.position.y + image->size.y)
+    };
+
+    bool opaque = softImageOccludes(image, SOFT_MAX(source.position.y, 0), SOFT_MIN(source.position.y + source.size.y, image->size.y), tint);
+    SoftDrawCommand* command = softDeferCommand(SOFT_COMMAND_IMAGE_REC, area, true, opaque, tint);
+
+    if(command) {
+        command->image.image = *image;
+        command->image.source = source;
+        command->image.dest.position = position;
+        return;
+    }
+
+    if(CORE.Camera.active) {
+        if(softCameraCulls(position.x, position.y, position.x + source.size.x, position.y + source.size.y)) {
+            return;
+        }
+
+        position = softVectorAdd(position, CORE.Camera.translation);
+    }
+
+    // [origin]: where the image's top-left pixel would land, so the region stays in image coordinates.
+    iVec2 origin = softVectorSub(position, source.position);
+    SoftBounds clip = softGetClipBounds();
+
+    i32 x0 = SOFT_MAX(SOFT_MAX(position.x, origin.x), clip.x0);
+    i32 y0 = SOFT_MAX(SOFT_MAX(position.y, origin.y), clip.y0);
+    i32 x1 = SOFT_MIN(SOFT_MIN(position.x + source.size.x, origin.x + image->size.x), clip.x1);
+    i32 y1 = SOFT_MIN(SOFT_MIN(position.y + source.size.y, origin.y + image->size.y), clip.y1);
+
+    if(x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    // The runs of a row are walked from its first column, so they only pay off for regions that start there.
+    if(image->runs && source.position.x <= 0) {
+        softDrawImageRuns(image, origin, x0, y0, x1, y1, false, tint);
+        return;
+    }
+
+    SoftCopyKernel copy = softGetCopyKernel();
+    bool tinted = !softPixelCompare(tint, WHITE);
+
+    for(i32 y = y0; y < y1; y++) {
+        softCopyImageSpan(
+            &CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x0], 
+            &image->data[(y - origin.y) * image->size.x + x0 - origin.x], 
+            x1 - x0, 
+            tint, 
+            tinted, 
+            copy
+        );
+    }
+}
+
+SAPI void softDrawAtlasRegion(Atlas* atlas, i32 index, iVec2 position, Pixel tint) {
+    if(!atlas || index < 0 || index >= atlas->region_count) {
+        softLogWarning("softDrawAtlasRegion: Invalid atlas region: %i. Returning...", index);
+        return;
+    }
+
+    AtlasRegion region = atlas->regions[index];
+    softDrawImageRec(&atlas->pages[region.page], region.rect, position, tint);
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_LOGGING
+// ------------------------------------------------------
+
+SAPI void softLog(SoftLogLevel log_level, const string restrict txt, ...) {
+    switch(log_level) {
+        case LOG_INFO:
+            softLogInfo(txt);
+            break;
+
+        case LOG_WARNING:
+            softLogWarning(txt);
+            break;
+
+        case LOG_ERROR:
+            softLogError(txt);
+            break;
+
+        default:
+            softLogWarning("Invalid log level: %i", (i32)(log_level));
+            break;
+    }
+}
+
+
+SAPI void softLogInfo(const string restrict txt, ...) {
+    char buf[256];
+
+    va_list list;
+    va_start(list, txt);
+
+        vsnprintf(buf, sizeof(buf), txt, list);
+
+    va_end(list);
+
+    fprintf(stdout, "[INFO] %s\n", buf);
+}
+
+SAPI void softLogWarning(const string restrict txt, ...) {
+    char buf[256];
+
+    va_list list;
+    va_start(list, txt);
+
+        vsnprintf(buf, sizeof(buf), txt, list);
+
+    va_end(list);
+
+    fprintf(stdout, "[WARN] %s\n", buf);
+}
+
+SAPI void softLogError(const string restrict txt, ...) {
+    char buf[256];
+
+    va_list list;
+    va_start(list, txt);
+
+        vsnprintf(buf, sizeof(buf), txt, list);
+
+    va_end(list);
+
+    fprintf(stderr, "[ERR] %s\n", buf);
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_TEXT
+// ------------------------------------------------------
+
+SAPI const string softTextFormat(const string restrict txt, ...) {
+    // The result is allocated from the frame arena: it stays valid until the next softBlit.
+    global char empty[1] = { 0 };
+
+    va_list list, measure;
+    va_start(list, txt);
+    va_copy(measure, list);
+
+        i32 length = vsnprintf(NULL, 0, txt, measure);
+        string result = length >= 0 ? (string)softFrameAlloc(length + 1) : NULL;
+
+        if(result) {
+            vsnprintf(result, length + 1, txt, list);
+        }
+
+    va_end(measure);
+    va_end(list);
+
+    return result ? result : empty;
+}
+
+SAPI const bool softTextEmpty(const string restrict txt, ...) {
+    return txt[0] != '\0';
+}
+
+SAPI const i32 softTextLength(const string restrict txt) {
+    return SDL_strlen(txt);
+}
+
+SAPI iVec2 softMeasureText(const string text, i32 size) {
+    return softMeasureTextEx(softGetDefaultFont(size), text);
+}
+
+SAPI iVec2 softMeasureTextEx(Font* font, const string text) {
+    if(!font || !text || !*text) {
+        return softVectorZero();
+    }
+
+    iVec2 result = { 0, font->line_height };
+    i32 line_width = 0;
+
+    for(const char* c = text; *c; c++) {
+        if(*c == '\n') {
+            line_width = 0;
+            result.y += font->line_height;
+            continue;
+        }
+
+        i32 index = (u8)(*c) - SOFT_FONT_GLYPH_FIRST;
+        line_width += font->glyphs[(index >= 0 && index < SOFT_FONT_GLYPH_COUNT) ? index : '?' - SOFT_FONT_GLYPH_FIRST].advance;
+        result.x = SOFT_MAX(result.x, line_width);
+    }
+
+    return result;
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_COLOR
+// ------------------------------------------------------
+
+SAPI Pixel softGetPixelColor(i32 x, i32 y) {
+    softFlushDeferred();
+
+    if(x < 0 || x >= CORE.PixelBuffer.size.x || y < 0 || y >= CORE.PixelBuffer.size.y) {
+        return BLACK;
+    }
+
+    return CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x];
+}
+
+SAPI Pixel softGetPixelFromBuffer(PixelBuffer buffer, iVec2 position, iVec2 size) {
+    if(position.x < 0 || position.x >= size.x || position.y < 0 || position.y >= size.y) {
+        return BLACK;
+    }
+
+    return buffer[position.y * size.x + position.x];
+}
+
+SAPI Pixel softColorToPixel(Color color) {
+    Pixel result = { 0 };
+
+    // NOTE: Remember about the reverse order of the bytes.
+    // This library is designed with the little endian architecture in mind!
+    // Order of the bytes is as follows: 0xAABBGGRR
+    // AA - alpha
+    // BB - blue
+    // GG - green
+    // RR - red
+    // We need to shift out bytes in the way that is compatible with the rule of endianess.
+    // RR . result.r - we don't need to shift out bits to the left
+    // GG . result.g - we need to shift to the left by 8 bits (1 byte = 1 uint8_t)
+    // BB . result.b - we need to shift to the left by 16 bits (2 bytes = 2 uint8_t's)
+    // AA . result.a - we need to shift to the left by 24 bits (3 bytes = 3 uint8_t's)
+
+    result = 
+        color.r | 
+        color.g << 8 | 
+        color.b << 16 | 
+        color.a << 24;
+
+    return result;
+}
+
+SAPI Color softPixelToColor(Pixel pixel) {
+    Color result = { 0 };
+
+    // NOTE: Remember about the reverse order of the bytes.
+    // This library is designed with the little endian architecture in mind!
+    // Order of the bytes is as follows: 0xAABBGGRR
+    // AA - alpha
+    // BB - blue
+    // GG - green
+    // RR - red
+    // When we want to get the values of our struct to the iColor variable, we need to shift our bytes correctly
+    // result.r . RR - this is our starting point, so we don't need to shidt our bytes to the right
+    // result.g . GG - we need to shift to the right by 8 bits (1 byte = 1 uint8_t)
+    // result.b . BB - we need to shift to the right by 16 bits (2 bytes = 2 uint8_t's)
+    // result.a . AA - we need to shift to the right by 24 bits (3 bytes = 3 uint8_t's)
+
+
+    result.r = (pixel >> 8 * 0) & 0xFF;
+    result.g = (pixel >> 8 * 1) & 0xFF;
+    result.b = (pixel >> 8 * 2) & 0xFF;
+    result.a = (pixel >> 8 * 3) & 0xFF;
+
+    return result;
+}
+
+SAPI Color softMixColor(Color base_color, Color return_color, u8 alpha) {
+    Color result = return_color;
+
+    // Check if the alpha equals 255.
+    // That means the color is opaque, so there's no need to blend it.
+    // Not every object on the screen will be opaque, so this saves a lot of computational power.
+    if(alpha == 255) {
+        return result;
+    } else if(alpha == 0) {
+        return softPixelToColor(BLANK);
+    }
+
+    result.r = base_color.r + (return_color.r - base_color.r) * (alpha / 255.0);
+    result.g = base_color.g + (return_color.g - base_color.g) * (alpha / 255.0);
+    result.b = base_color.b + (return_color.b - base_color.b) * (alpha / 255.0);
+    result.a = alpha;
+
+    return result;
+}
+
+SAPI Pixel softMixPixels(Pixel base_pixel, Pixel return_pixel, u8 alpha) {
+    Color base = softPixelToColor(base_pixel);
+    Color result = softPixelToColor(return_pixel);
+
+    // Check if the alpha equals 255.
+    // That means the color is opaque, so there's no need to blend it.
+    // Not every object on the screen will be opaque, so this saves a lot of computational power.
+    if(alpha == 255) {
+        return softColorToPixel(result);
+    } else if(alpha == 0) {
+        return BLANK;
+    }
+
+    result.r = base.r + (result.r - base.r) * (alpha / 255.0);
+    result.g = base.g + (result.g - base.g) * (alpha / 255.0);
+    result.b = base.b + (result.b - base.b) * (alpha / 255.0);
+    result.a = alpha;
+
+    return softColorToPixel(result);
+}
+
+SAPI Color softColorFade(Color color, f32 factor) {
+    return (Color) {
+        color.r,
+        color.g,
+        color.b,
+        factor * 255
     };
 }
 
-SAPI iVec2 softGetPreviousMousePosition(void) {
-    return (iVec2) {
-        (CORE.Input.Mouse.position_previous.x + CORE.Input.Mouse.offset.x) * CORE.Input.Mouse.scale.x,
-        (CORE.Input.Mouse.position_previous.y + CORE.Input.Mouse.offset.y) * CORE.Input.Mouse.scale.y
+SAPI Pixel softPixelFade(Pixel pixel, f32 factor) {
+    return softColorToPixel(
+        softColorFade(
+            softPixelToColor(pixel), 
+            factor
+        )
+    );
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_TIME
+// ------------------------------------------------------
+
+SAPI f32 softDeltaTime(void) {
+    return CORE.Time.delta_time;
+}
+
+SAPI f32 softTime(void) {
+    u32 miliseconds = SDL_GetTicks();
+    i32 second_size = 1000;
+
+    CORE.Time.application_lifetime = (f32)(miliseconds) / second_size;
+
+    return CORE.Time.application_lifetime;
+}
+
+SAPI i32 softFPS(void) {
+    return 1 / CORE.Time.delta_time;
+}
+
+SAPI FrameTimes softGetFrameTimePercentiles(void) {
+    // Nearest-rank percentiles of the last SOFT_FRAME_TIME_WINDOW frame times, in seconds (all zero before the second softBlit).
+    i32 count = CORE.Time.frame_time_count;
+    f32 sorted[SOFT_FRAME_TIME_WINDOW];
+
+    if(count == 0) {
+        return (FrameTimes) { 0 };
+    }
+
+    memcpy(sorted, CORE.Time.frame_times, count * sizeof(f32));
+    qsort(sorted, count, sizeof(f32), softCompareFrameTimes);
+
+    return (FrameTimes) {
+        sorted[(count * 50 + 99) / 100 - 1],
+        sorted[(count * 95 + 99) / 100 - 1],
+        sorted[(count * 99 + 99) / 100 - 1],
+        sorted[count - 1],
+        count
     };
 }
 
-SAPI iVec2 softGetMouseDelta(void) {
+SAPI void softDrawFrameTimeGraph(Rect area) {
+    // Draws the frame time window into [area] (screen space): a bar per frame, the newest on the right, and the percentiles in milliseconds.
+    // The scale tops out at twice the target frame time (1/60 s without a target). Green bars are within the target, yellow ones
+    // over it and red ones off the scale; the white line marks the target and the pink one the p99.
+    if(area.size.x <= 0 || area.size.y <= 0) {
+        return;
+    }
+
+    FrameTimes times = softGetFrameTimePercentiles();
+    f32 budget = CORE.Time.frame_target > 0.0f ? CORE.Time.frame_target : 1.0f / 60.0f;
+    f32 scale = area.size.y / (2.0f * budget);
+    i32 bottom = area.position.y + area.size.y;
+
+    SoftBlendMode blend_mode = CORE.Config.blend_mode;
+    bool camera_active = CORE.Camera.active;
+    CORE.Config.blend_mode = BLEND_ALPHA;
+    CORE.Camera.active = false;
+
+    softDrawRectangle(area, 0xA0000000);
+
+    i32 count = SOFT_MIN(CORE.Time.frame_time_count, area.size.x);
+
+    for(i32 i = 0; i < count; i++) {
+        f32 time = CORE.Time.frame_times[(CORE.Time.frame_time_next - 1 - i + SOFT_FRAME_TIME_WINDOW) % SOFT_FRAME_TIME_WINDOW];
+        i32 height = SOFT_CLAMP((i32)(time * scale + 0.5f), 1, area.size.y);
+        Pixel pixel = time > 2.0f * budget ? RED : time > budget ? YELLOW : GREEN;
+
+        softDrawRectangle((Rect) { { area.position.x + area.size.x - 1 - i, bottom - height }, { 1, height } }, pixel);
+    }
+
+    i32 target = bottom - (i32)(budget * scale + 0.5f);
+    i32 p99 = bottom - SOFT_MIN((i32)(times.p99 * scale + 0.5f), area.size.y);
+
+    softDrawRectangle((Rect) { { area.position.x, target }, { area.size.x, 1 } }, 0xC0FFFFFF);
+    softDrawRectangle((Rect) { { area.position.x, p99 }, { area.size.x, 1 } }, PINK);
+
+    softDrawText(
+        softTextFormat("p50 %.1f  p95 %.1f  p99 %.1f  max %.1f ms", times.p50 * 1000.0f, times.p95 * 1000.0f, times.p99 * 1000.0f, times.max * 1000.0f),
+        (iVec2) { area.position.x + 2, area.position.y + 2 },
+        1,
+        WHITE
+    );
+
+    CORE.Config.blend_mode = blend_mode;
+    CORE.Camera.active = camera_active;
+}
+
+SAPI void softTargetFPS(u32 framerate) {
+    CORE.Time.framerate = framerate;
+    CORE.Time.frame_target = 1.0f / framerate;
+
+    softLogInfo("softTargetFPS: Framerate: %iFPS (%0.04fms)", CORE.Time.framerate, CORE.Time.frame_target);
+}
+
+SAPI void softWait(f32 seconds) {
+    SDL_Delay(seconds * 1000);
+}
+
+SAPI Timer softTimer(const f32 TIME) {
+    return (Timer) {
+        TIME,
+        TIME,
+        false
+    };
+}
+
+SAPI void softTimerProceed(Timer* timer, f32 delta_time) {
+    if(!softTimerFinished(timer)) {
+        timer->current_time -= delta_time;
+    }
+}
+SAPI bool softTimerFinished(Timer* timer) {
+    timer->finished = timer->current_time <= 0.0f;
+
+    return timer->finished;
+}
+
+SAPI void softTimerRestart(Timer* timer) {
+    timer->current_time = timer->initial_time;
+    timer->finished = false;
+}
+
+SAPI void softTimerReset(Timer* timer, f32 time) {
+    timer->initial_time = timer->initial_time;
+    timer->current_time = timer->initial_time;
+    timer->finished = false;
+}
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_MATH
+// ------------------------------------------------------
+
+SAPI f32 softLerpF(f32 start, f32 end, f32 t) {
+    return start + (end - start) * t;
+}
+
+SAPI f32 softPowF(f32 a, f32 n) {
+    return pow(a, n);
+}
+
+SAPI f32 softSqrF(f32 a) {
+    return pow(a, 2);
+}
+
+SAPI f32 softSqrtF(f32 a) {
+    return sqrt(a);
+}
+
+SAPI i32 softLerpI(i32 start, i32 end, f32 t) {
+    return start + (end - start) * t;
+}
+
+SAPI i32 softPowI(i32 a, i32 n) {
+    return pow(a, n);
+}
+
+SAPI i32 softSqrI(i32 a) {
+    return pow(a, 2);
+}
+
+SAPI i32 softSqrtI(i32 a) {
+    return sqrt(a);
+}
+
+SAPI iVec2 softVectorZero(void) {
+    return (iVec2) { 0.0f, 0.0f };
+}
+
+SAPI iVec2 softVectorOne(void) {
+    return (iVec2) { 1.0f, 1.0f };
+}
+
+SAPI iVec2 softVectorUp(void) {
+    return (iVec2) { 0.0f, -1.0f };
+}
+
+SAPI iVec2 softVectorDown(void) {
+    return (iVec2) { 0.0f, 1.0f };
+}
+
+SAPI iVec2 softVectorLeft(void) {
+    return (iVec2) { -1.0f, 0.0f };
+}
+
+SAPI iVec2 softVectorRight(void) {
+    return (iVec2) { 1.0f, 0.0f };
+}
+
+SAPI iVec2 softVectorAdd(iVec2 a, iVec2 b) {
+    return (iVec2) { a.x + b.x, a.y + b.y };
+}
+
+SAPI iVec2 softVectorSub(iVec2 a, iVec2 b) {
+    return (iVec2) { a.x - b.x, a.y - b.y };
+}
+
+SAPI iVec2 softVectorMult(iVec2 a, iVec2 b) {
+    return (iVec2) { a.x * b.x, a.y * b.y };
+}
+
+SAPI iVec2 softVectorMultFactor(iVec2 a, f32 factor) {
+    return (iVec2) { a.x * factor, a.y * factor };
+}
+
+SAPI iVec2 softVectorDiv(iVec2 a, iVec2 b) {
+    return (iVec2) { a.x / b.x, a.y / b.y };
+}
+
+SAPI iVec2 softVectorDivFactor(iVec2 a, f32 factor) {
+    return (iVec2) { a.x / factor, a.y / factor };
+}
+
+SAPI iVec2 softVectorLerp(iVec2 start, iVec2 end, f32 t) {
     return (iVec2) {
-        CORE.Input.Mouse.position_current.x - CORE.Input.Mouse.position_previous.x,
-        CORE.Input.Mouse.position_current.y - CORE.Input.Mouse.position_previous.y
+        softLerpI(start.x, end.x, t),
+        softLerpI(start.y, end.y, t)
+    };
+}
+
+SAPI bool softVectorCompare(iVec2 a, iVec2 b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+SAPI Color softColorZero(void) {
+    return (Color) { 0, 0, 0, 0 };
+}
+
+SAPI Color softColorOne(void) {
+    return (Color) { 1, 1, 1, 1 };
+}
+
+SAPI Color softColorAdd(Color a, Color b) {
+    return (Color) { 
+        a.r + b.r, 
+        a.g + b.g, 
+        a.b + b.b, 
+        a.a + b.a
+    };
+}
+
+SAPI Color softColorSub(Color a, Color b) {
+    return (Color) { 
+        a.r - b.r, 
+        a.g - b.g, 
+        a.b - b.b, 
+        a.a - b.a
+    };
+}
+
+SAPI Color softColorMult(Color a, Color b) {
+    return (Color) { 
+        a.r * b.r, 
+        a.g * b.g, 
+        a.b * b.b, 
+        a.a * b.a
+    };
+}
+
+SAPI Color softColorDiv(Color a, Color b) {
+    return (Color) { 
+        a.r / b.r, 
+        a.g / b.g, 
+        a.b / b.b, 
+        a.a / b.a
+    };
+}
+
+SAPI Color softColorLerp(Color start, Color end, f32 t) {
+    return (Color) { 
+        softLerpI(start.r, end.r, t), 
+        softLerpI(start.g, end.g, t), 
+        softLerpI(start.b, end.b, t), 
+        softLerpI(start.a, end.a, t)
     };
 }
 
-SAPI iVec2 softGetMouseWheel(void) {
-    return CORE.Input.Mouse.wheel_move;
+SAPI bool softColorCompare(Color a, Color b) {
+    return 
+        (a.r == b.r) &&
+        (a.g == b.g) &&
+        (a.b == b.b) &&
+        (a.a == b.a);
+}
+
+SAPI bool softPixelCompare(Pixel a, Pixel b) {
+    return a == b;
 }
 
-SAPI bool softKeyPressed(softKeyCode key) {
-    bool pressed = false;
 
-    if(CORE.Input.Keyboard.key_pressed_current[key] && !CORE.Input.Keyboard.key_pressed_previous[key]) {
-        pressed = true;
-    }
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
 
-    return pressed;
-}
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_IMAGE
+// ------------------------------------------------------
 
-SAPI bool softKeyReleased(softKeyCode key) {    
-    bool released = false;
+SAPI Image softLoadImage(const string path) {
+    Image result = { 0 };
 
-    if(!CORE.Input.Keyboard.key_pressed_current[key] && CORE.Input.Keyboard.key_pressed_previous[key]) {
-        released = true;
+    if(!softDecodeImage(path, CORE.Config.image_runs, &result)) {
+        return result;
     }
 
-    return released;
-}
-
-SAPI bool softKeyDown(softKeyCode key) {
-    return CORE.Input.Keyboard.key_pressed_current[key];
-}
+    softLogInfo("softLoadImage: Image loaded successfully:");
+    softLogInfo("   > resolution: %ix%ipx", result.size.x, result.size.y);
+    softLogInfo("   > channels: %i", result.channels);
+    softLogInfo("   > size: %i bytes", result.size.x * result.size.y * sizeof(Pixel));
 
-SAPI bool softKeyUp(softKeyCode key) {    
-    return !CORE.Input.Keyboard.key_pressed_current[key];
+    return result;
 }
 
-SAPI bool softMouseButtonPressed(softMouseButtons button) {
-    bool pressed = false;
+SAPI ImageJob* softLoadImageAsync(const string path) {
+    if(!path) {
+        softLogError("softLoadImageAsync: Path not valid. Returning...");
+        return NULL;
+    }
 
-    if(CORE.Input.Mouse.mouse_button_pressed_current[button] && !CORE.Input.Mouse.mouse_button_pressed_previous[button]) {
-        pressed = true;
+    if(CORE.Loader.worker_count == 0 && !softInitLoader()) {
+        softLogError("softLoadImageAsync: Image loader not available. Returning...");
+        return NULL;
     }
 
-    return pressed;
+    // The path is copied right after the job.
+    size_t length = strlen(path) + 1;
+    ImageJob* job = (ImageJob*)calloc(1, sizeof(ImageJob) + length);
 
-}
+    if(!job || !(job->finished = SDL_CreateSemaphore(0))) {
+        softLogError("softLoadImageAsync: Job could not be created. Returning...");
+        free(job);
+        return NULL;
+    }
 
-SAPI bool softMouseButtonReleased(softMouseButtons button) {
-    bool released = false;
+    memcpy(job + 1, path, length);
+    job->path = (const char*)(job + 1);
+    job->runs = CORE.Config.image_runs;
 
-    if(!CORE.Input.Mouse.mouse_button_pressed_current[button] && CORE.Input.Mouse.mouse_button_pressed_previous[button]) {
-        released = true;
+    SDL_LockMutex(CORE.Loader.lock);
+
+    if(CORE.Loader.tail) {
+        CORE.Loader.tail->next = job;
+    } else {
+        CORE.Loader.head = job;
     }
 
-    return released;
+    CORE.Loader.tail = job;
 
-}
+    SDL_UnlockMutex(CORE.Loader.lock);
+    SDL_SemPost(CORE.Loader.pending);
 
-SAPI bool softMouseButtonDown(softMouseButtons button) {
-    return CORE.Input.Mouse.mouse_button_pressed_current[button];
+    return job;
 }
 
-SAPI bool softMouseButtonUp(softMouseButtons button) {
-    return !CORE.Input.Mouse.mouse_button_pressed_current[button];
+SAPI bool softImageReady(ImageJob* job) {
+    return job && SDL_AtomicGet(&job->done) != 0;
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+SAPI Image softWaitImage(ImageJob* job) {
+    // Blocks until the image is decoded (returns immediately when softImageReady is true), then releases the job.
+    Image result = { 0 };
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_RENDER
-// ------------------------------------------------------
+    if(!job) {
+        softLogWarning("softWaitImage: Job not valid. Returning...");
+        return result;
+    }
 
+    SDL_SemWait(job->finished);
 
-SAPI void softClearBuffer(void) {
-    if(!CORE.PixelBuffer.pixel_buffer) {
-        softLogError("softClearBuffer: Pixel buffer not valid. Returning...");
-        return;
-    }
+    result = job->image;
+
+    SDL_DestroySemaphore(job->finished);
+    free(job);
 
-    SDL_memset(CORE.PixelBuffer.pixel_buffer, 0, CORE.Window.display_size.x * CORE.Window.display_size.y * sizeof(Pixel));
+    return result;
 }
 
-SAPI void softClearBufferColor(Pixel pixel) {
-    if(!CORE.PixelBuffer.pixel_buffer) {
-        softLogError("softClearBufferColor: Pixel buffer not valid. Returning...");
+SAPI void softEncodeImageRuns(Image* image) {
+    // (Re)builds the run encoding of the image; call it again after changing the pixels.
+    softFlushDeferred();
+
+    if(!image || !image->data) {
+        softLogWarning("softEncodeImageRuns: Trying to encode invalid image data.");
         return;
     }
 
-    iVec2 clear_region = {
-        ((CORE.Window.display_size.x - (CORE.Window.display_size.x - CORE.Window.screen_size.x))) - (CORE.Window.screen_size.x - CORE.PixelBuffer.size.x),
-        ((CORE.Window.display_size.y - (CORE.Window.display_size.y - CORE.Window.screen_size.y))) - (CORE.Window.screen_size.y - CORE.PixelBuffer.size.y)
-    };
+    free(image->runs);
+    image->runs = softBuildImageRuns(image);
+}
+
+SAPI Atlas softLoadAtlas(const Image* images, i32 count, iVec2 page_size) {
+    // Packs [images] into as few [page_size] pages as possible; region i holds the page and the rectangle of images[i].
+    // The pages are trimmed to the height they use. The source images are left untouched.
+    Atlas result = { 0 };
+
+    if(!images || count <= 0 || page_size.x <= 0 || page_size.y <= 0) {
+        softLogError("softLoadAtlas: Invalid atlas parameters. Returning...");
+        return result;
+    }
 
-    for(i32 y = 0; y < clear_region.y; y++) {
-        for(i32 x = 0; x < clear_region.x; x++) {
-            softSetPixel(x, y, pixel);
+    for(i32 i = 0; i < count; i++) {
+        if(!images[i].data || images[i].size.x > page_size.x || images[i].size.y > page_size.y) {
+            softLogError("softLoadAtlas: Image %i is not valid or doesn't fit in a page. Returning...", i);
+            return result;
         }
     }
-}
 
-SAPI void softBlit(void) {
-    if(!CORE.PixelBuffer.pixel_buffer) {
-        softLogError("softBlit: Pixel data not valid. Returning...");
-        return;
-    } else if(!CORE.Render.render_texture) {
-        softLogError("softBlit: Render Texture not valid. Returning...");
-        return;
-    } else if(!CORE.Render.renderer_valid) {
-        softLogError("softBlit: Renderer not valid. Returning...");
-        return;
+    SoftArenaMark mark = softFrameMark();
+    i32* order = (i32*)softFrameAlloc(count * sizeof(i32));
+    SoftSkyline* skylines = (SoftSkyline*)softFrameAlloc(count * sizeof(SoftSkyline));
+    result.regions = (AtlasRegion*)malloc(count * sizeof(AtlasRegion));
+
+    if(!order || !skylines || !result.regions) {
+        softLogError("softLoadAtlas: Atlas could not be allocated. Returning...");
+        softFrameRelease(mark);
+        free(result.regions);
+        return (Atlas) { 0 };
     }
 
-    SDL_Rect source_rect = {
-        0,
-        0,
-        CORE.PixelBuffer.size.x,
-        CORE.PixelBuffer.size.y
-    };
+    for(i32 i = 0; i < count; i++) {
+        order[i] = i;
+    }
 
-    SDL_Rect destination_rect = {
-        0,
-        0,
-        CORE.Window.display_size.x,
-        CORE.Window.display_size.y
-    };
+    soft_atlas_sort_images = images;
+    qsort(order, count, sizeof(i32), softCompareAtlasImages);
 
-    SDL_UpdateTexture(
-        CORE.Render.render_texture,
-        &source_rect,
-        CORE.PixelBuffer.pixel_buffer, 
-        CORE.PixelBuffer.size.x * sizeof(Pixel)
-    );
+    i32 page_count = 0;
 
-    SDL_RenderCopyEx(
-        CORE.Render.renderer, 
-        CORE.Render.render_texture, 
-        &source_rect, 
-        &destination_rect,
-        0.0,
-        NULL,
-        SDL_FLIP_NONE
-    );
+    for(i32 n = 0; n < count; n++) {
+        i32 i = order[n];
+        i32 page = 0, index = 0, y = 0, width = 0;
 
-    SDL_RenderPresent(CORE.Render.renderer);
+        for(; page < page_count && !softSkylineFind(&skylines[page], page_size, images[i].size, &index, &y, &width); page++);
 
-    softTimeMenagement();
-    softPollEvents();
-}
+        // A new page always fits the image (the sizes were checked above).
+        if(page == page_count) {
+            SoftSkyline* skyline = &skylines[page_count++];
+            skyline->nodes = (SoftSkylineNode*)softFrameAlloc((page_size.x + 1) * sizeof(SoftSkylineNode));
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+            if(!skyline->nodes) {
+                softFrameRelease(mark);
+                free(result.regions);
+                return (Atlas) { 0 };
+            }
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_DRAW
-// ------------------------------------------------------
+            skyline->nodes[0] = (SoftSkylineNode) { 0, 0, page_size.x };
+            skyline->count = 1;
+            skyline->height = 0;
 
-SAPI void softDrawRectangle(Rect rect, Pixel pixel) {
-    for(i32 i = 0; i < rect.size.y; i++) {
-        for(i32 j = 0; j < rect.size.x; j++) {
-            softSetPixel(rect.position.x + j, rect.position.y + i, pixel);
+            softSkylineFind(skyline, page_size, images[i].size, &index, &y, &width);
         }
-    }
-}
-
-SAPI void softDrawRectangleLines(Rect rect, Pixel pixel) {
-    Line rect_lines[4]  = {
-        { (iVec2) { rect.position.x, rect.position.y }, (iVec2) { rect.position.x + rect.size.x, rect.position.y } },
-        { (iVec2) { rect.position.x, rect.position.y }, (iVec2) { rect.position.x, rect.position.y + rect.size.y} },
-        { (iVec2) { rect.position.x + rect.size.x, rect.position.y }, (iVec2) { rect.position.x + rect.size.x, rect.position.y + rect.size.y } },
-        { (iVec2) { rect.position.x, rect.position.y + rect.size.y }, (iVec2) { rect.position.x + rect.size.x, rect.position.y + rect.size.y } },
-    };
 
-    for(i32 i = 0; i < 4; i++) {
-        softDrawLine(rect_lines[i], pixel);
+        result.regions[i] = (AtlasRegion) { page, { { skylines[page].nodes[index].x, y }, images[i].size } };
+        softSkylineInsert(&skylines[page], index, y, images[i].size);
     }
-}
 
-SAPI void softDrawRectangleEx(Rect rect, iVec2 pivot, Pixel pixel) {
-    softDrawRectangle(
-        (Rect) {
-            (iVec2) {
-                rect.position.x - pivot.x,
-                rect.position.y - pivot.y,
-            },
-            rect.size
-        },
-        pixel
-    );
-}
+    result.pages = (Image*)calloc(page_count, sizeof(Image));
+    result.region_count = count;
 
-SAPI void softDrawLine(Line line, Pixel pixel) {
-    // Source: https://en.wikipedia.org/wiki/Digital_differential_analyzer_(graphics_algorithm)
+    bool allocated = result.pages != NULL;
 
-    f32 dx = line.b.x - line.a.x;
-    f32 dy = line.b.y - line.a.y;
-    f32 steps = 0;
-    f32 i = 0;
+    for(i32 page = 0; allocated && page < page_count; page++) {
+        Image* image = &result.pages[page];
 
-    f32 x = 0;
-    f32 y = 0;
+        image->size = (iVec2) { page_size.x, skylines[page].height };
+        image->channels = 4;
+        image->data = (PixelBuffer)calloc(image->size.x * image->size.y, sizeof(Pixel));
 
-    if (abs((i32)(dx)) >= abs((i32)(dy))) {
-        steps = abs((i32)(dx));
-    } else {
-        steps = abs((i32)(dy));
+        allocated = image->data != NULL;
+        result.page_count++;
     }
 
-    dx = dx / steps;
-    dy = dy / steps;
-    x = line.a.x;
-    y = line.a.y;
+    softFrameRelease(mark);
 
-    while (i <= steps) {
-        softSetPixel(x, y, pixel);
-        x += dx;
-        y += dy;
-        i++;
+    if(!allocated) {
+        softLogError("softLoadAtlas: Atlas could not be allocated. Returning...");
+        softUnloadAtlas(&result);
+        return result;
     }
-}
 
-SAPI void softDrawLineBezier(iVec2 start, iVec2 end, iVec2 midpoint, i32 resolution, Pixel pixel) {
-    // Source: https://youtu.be/SO83KQuuZvg?t=642
+    for(i32 i = 0; i < count; i++) {
+        const AtlasRegion* region = &result.regions[i];
+        Image* page = &result.pages[region->page];
 
-    iVec2 curve_point_prev = start;
+        for(i32 y = 0; y < images[i].size.y; y++) {
+            memcpy(
+                &page->data[(region->rect.position.y + y) * page->size.x + region->rect.position.x], 
+                &images[i].data[y * images[i].size.x], 
+                images[i].size.x * sizeof(Pixel)
+            );
+        }
+    }
 
-    for(i32 i = 0; i < resolution; i++) {
-        f32 t = (i + 1.0f) / resolution;
+    softLogInfo("softLoadAtlas: Atlas packed successfully:");
+    softLogInfo("   > images: %i", count);
+    softLogInfo("   > pages: %i (%ipx wide)", page_count, page_size.x);
 
-        iVec2 curve_point_next = softVectorLerp(
-            softVectorLerp(
-                start, 
-                midpoint, 
-                t
-            ), 
-            softVectorLerp(
-                midpoint, 
-                end, 
-                t
-            ), 
-            t
-        );
+    return result;
+}
 
-        softDrawLine((Line) { curve_point_prev, curve_point_next }, pixel);
-        curve_point_prev = curve_point_next;
+SAPI void softUnloadAtlas(Atlas* atlas) {
+    for(i32 i = 0; i < atlas->page_count; i++) {
+        if(atlas->pages[i].data) {
+            softUnloadImage(&atlas->pages[i]);
+        }
     }
-}
 
-SAPI void softDrawCircle(Circle circle, Pixel pixel) {
-    // Source: https://youtu.be/LmQKZmQh1ZQ?list=PLpM-Dvs8t0Va-Gb0Dp4d9t8yvNFHaKH6N&t=3088
+    free(atlas->pages);
+    free(atlas->regions);
+    *atlas = (Atlas) { 0 };
+}
 
-    i32 x0 = circle.position.x - circle.r;
-    i32 x1 = circle.position.x + circle.r;
+SAPI void softUnloadImage(Image* image) {
+    softFlushDeferred();
 
-    i32 y0 = circle.position.y - circle.r;
-    i32 y1 = circle.position.y + circle.r;
+    if(image->data == NULL) {
+        softLogWarning("softUnloadImage: Trying to unload invalid image data.");
+        return;
+    }
 
-    for(i32 y = y0; y < y1; y++) {
-        for(i32 x = x0; x < x1; x++) {
-            i32 x_delta = x - circle.position.x;
-            i32 y_delta = y - circle.position.y;
+    free(image->runs);
+    image->runs = NULL;
 
-            if(softSqrI(x_delta) + softSqrI(y_delta) <= softSqrI(circle.r)) {
-                softSetPixel(x, y, pixel);
-            }
-        }
+    // Packed images are released with their pack.
+    if(softPackOwns(image->data)) {
+        image->data = NULL;
+        return;
     }
+
+    free(image->data);
+    softLogInfo("softUnloadImage: Image unloaded successfully.");
 }
 
-SAPI void softDrawCircleLines(Circle circle, Pixel pixel) {
-    // Source: https://zingl.github.io/bresenham.html
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
 
-    i32 r = circle.r;
-    i32 x = r * -1;
-    i32 y = 0; 
-    i32 err = 2 - 2 * r; 
+// ------------------------------------------------------
+#pragma region SOFT_API_FUNC_FONT
+// ------------------------------------------------------
 
-    do {
-        softSetPixel(circle.position.x - x, circle.position.y + y, pixel);
-        softSetPixel(circle.position.x - y, circle.position.y - x, pixel);
-        softSetPixel(circle.position.x + x, circle.position.y - y, pixel);
-        softSetPixel(circle.position.x + y, circle.position.y + x, pixel);
+SAPI Font softLoadFont(const string path, i32 size) {
+    // [path]: a bitmap font sheet, the printable ASCII glyphs in rows of 16 equal cells. The ink is the alpha channel
+    // (or the gray level for sheets without one). [size]: the cell height is scaled by whole steps towards it, like the default font.
+    Font result = { 0 };
 
-        r = err;
+    if(size <= 0) {
+        softLogWarning("softLoadFont: Invalid font size: %i. Returning...", size);
+        return result;
+    }
 
-        if (r <= y) {
-            err += ++y * 2 + 1;
-        }
+    iVec2 sheet_size;
+    i32 channels;
+    u8* data = stbi_load(path, &sheet_size.x, &sheet_size.y, &channels, STBI_grey_alpha);
 
-        if (r > x || err > y) {
-            err += ++x * 2 + 1;
-        }
-    } while (x < 0);
-}
+    if(!data) {
+        softLogError("softLoadFont: %s", stbi_failure_reason());
+        return result;
+    }
 
-SAPI void softDrawImage(Image* image, iVec2 position, Pixel tint) {
-    softDrawImageEx(image, position, softVectorZero(), FLIP_DEFAULT, tint);
-}
+    const i32 columns = 16;
+    iVec2 cell = { sheet_size.x / columns, sheet_size.y / ((SOFT_FONT_GLYPH_COUNT + columns - 1) / columns) };
+    i32 ink = channels == 2 || channels == 4 ? 1 : 0;
 
-SAPI void softDrawImageEx(Image* image, iVec2 position, iVec2 pivot, SoftImageFlip image_flip, Pixel tint) {
-    switch (image_flip) {
-        case FLIP_DEFAULT: {
-            for(i32 y = 0; y < image->size.y; y++) {
-                for(i32 x = 0; x < image->size.x; x++) {
-                    softSetPixel(
-                        position.x + x - pivot.x, 
-                        position.y + y - pivot.y, 
-                        softGetPixelFromBuffer(
-                            image->data, 
-                            (iVec2) { x, y }, 
-                            image->size
-                        )
-                    );
-                }
-            }
+    if(cell.x <= 0 || cell.y <= 0) {
+        softLogError("softLoadFont: Font sheet too small: %ix%ipx. Returning...", sheet_size.x, sheet_size.y);
+        stbi_image_free(data);
+        return result;
+    }
 
-            break;
-        }
+    i32 scale = SOFT_MAX(size / cell.y, 1);
+
+    // The glyph rectangles are trimmed to their ink, so the blank rows and columns are never blitted.
+    for(i32 i = 0; i < SOFT_FONT_GLYPH_COUNT; i++) {
+        const u8* origin = &data[((i / columns) * cell.y * sheet_size.x + (i % columns) * cell.x) * 2 + ink];
+        i32 column_min = cell.x, column_max = -1, row_min = cell.y, row_max = -1;
 
-        case FLIP_H: {
-            for(i32 y = 0; y < image->size.y; y++) {
-                for(i32 x = image->size.x - 1, pos_x = 0; x >= 0; x--, pos_x++) {
-                    softSetPixel(
-                        position.x + pos_x - pivot.x, 
-                        position.y + y - pivot.y, 
-                        softGetPixelFromBuffer(
-                            image->data, 
-                            (iVec2) { x, y }, 
-                            image->size
-                        )
-                    );
+        for(i32 row = 0; row < cell.y; row++) {
+            for(i32 column = 0; column < cell.x; column++) {
+                if(origin[(row * sheet_size.x + column) * 2]) {
+                    column_min = SOFT_MIN(column_min, column);
+                    column_max = SOFT_MAX(column_max, column);
+                    row_min = SOFT_MIN(row_min, row);
+                    row_max = SOFT_MAX(row_max, row);
                 }
             }
-            
-            break;
         }
 
-        case FLIP_V: {
-            for(i32 y = image->size.y - 1, pos_y = 0; y >= 0; y--, pos_y++) {
-                for(i32 x = 0; x < image->size.x; x++) {
-                    softSetPixel(
-                        position.x + x - pivot.x, 
-                        position.y + pos_y - pivot.y, 
-                        softGetPixelFromBuffer(
-                            image->data, 
-                            (iVec2) { x, y }, 
-                            image->size
-                        )
-                    );
-                }
-            }
-            
-            break;
+        Glyph* glyph = &result.glyphs[i];
+        glyph->advance = cell.x * scale;
+
+        if(column_max >= 0) {
+            glyph->offset = (iVec2) { column_min * scale, row_min * scale };
+            glyph->size = (iVec2) { (column_max - column_min + 1) * scale, (row_max - row_min + 1) * scale };
         }
+    }
 
-        case FLIP_HV: {
-            for(i32 y = image->size.y - 1, pos_y = 0; y >= 0; y--, pos_y++) {
-                for(i32 x = image->size.x - 1, pos_x = 0; x >= 0; x--, pos_x++) {
-                    softSetPixel(
-                        position.x + pos_x - pivot.x, 
-                        position.y + pos_y - pivot.y, 
-                        softGetPixelFromBuffer(
-                            image->data, 
-                            (iVec2) { x, y }, 
-                            image->size
-                        )
-                    );
-                }
+    if(!softPackFontAtlas(&result)) {
+        stbi_image_free(data);
+        return (Font) { 0 };
+    }
+
+    for(i32 i = 0; i < SOFT_FONT_GLYPH_COUNT; i++) {
+        const Glyph* glyph = &result.glyphs[i];
+        const u8* origin = &data[((i / columns) * cell.y * sheet_size.x + (i % columns) * cell.x) * 2 + ink];
+
+        for(i32 y = 0; y < glyph->size.y; y++) {
+            const u8* src = &origin[(glyph->offset.y + y) / scale * sheet_size.x * 2];
+            u8* dst = &result.atlas[(glyph->position.y + y) * result.atlas_size.x + glyph->position.x];
+
+            for(i32 x = 0; x < glyph->size.x; x++) {
+                dst[x] = src[(glyph->offset.x + x) / scale * 2];
             }
-            
-            break;
         }
+    }
+
+    stbi_image_free(data);
+    result.line_height = cell.y * scale;
+
+    softLogInfo("softLoadFont: Font loaded successfully:");
+    softLogInfo("   > cell: %ix%ipx", cell.x * scale, cell.y * scale);
+    softLogInfo("   > atlas: %ix%ipx", result.atlas_size.x, result.atlas_size.y);
+
+    return result;
+}
 
-        default: {
-            softLogWarning("Invalid flip value: %i. Defaulting to value: 0 (FLIP_DEFAULT)...", image_flip);
-
-            for(i32 y = 0; y < image->size.y; y++) {
-                for(i32 x = 0; x < image->size.x; x++) {
-                    softSetPixel(
-                        position.x + x - pivot.x, 
-                        position.y + y - pivot.y, 
-                        softGetPixelFromBuffer(
-                            image->data, 
-                            (iVec2) { x, y }, 
-                            image->size
-                        )
-                    );
-                }
-            }
+SAPI void softUnloadFont(Font* font) {
+    softFlushDeferred();
 
-            break;
-        }
+    if(font->atlas == NULL) {
+        softLogWarning("softUnloadFont: Trying to unload invalid font data.");
+        return;
     }
+
+    free(font->atlas);
+    font->atlas = NULL;
+    softLogInfo("softUnloadFont: Font unloaded successfully.");
 }
 
 // ------------------------------------------------------
@@ -1386,109 +8074,157 @@ SAPI void softDrawImageEx(Image* image, iVec2 position, iVec2 pivot, SoftImageFl
 // ------------------------------------------------------
 
 // ------------------------------------------------------
-#pragma region SOFT_API_FUNC_LOGGING
+#pragma region SOFT_API_FUNC_PACK
 // ------------------------------------------------------
 
-SAPI void softLog(SoftLogLevel log_level, const string restrict txt, ...) {
-    switch(log_level) {
-        case LOG_INFO:
-            softLogInfo(txt);
-            break;
+SAPI Pack softLoadPack(const string path) {
+    Pack result = { 0 };
 
-        case LOG_WARNING:
-            softLogWarning(txt);
-            break;
+    if(CORE.Packs.count >= SOFT_PACK_COUNT_MAX) {
+        softLogError("softLoadPack: Too many packs loaded (max. %i). Returning...", SOFT_PACK_COUNT_MAX);
+        return result;
+    }
 
-        case LOG_ERROR:
-            softLogError(txt);
-            break;
+    u8* data = NULL;
+    u64 size = 0;
 
-        default:
-            softLogWarning("Invalid log level: %i", (i32)(log_level));
-            break;
+    if(!softMapFile(path, &data, &size)) {
+        softLogError("softLoadPack: Pack could not be mapped: %s", path);
+        return result;
     }
-}
 
+    if(!softValidatePack(data, size)) {
+        softLogError("softLoadPack: Pack data not valid: %s", path);
+        softUnmapFile(data, size);
+        return result;
+    }
 
-SAPI void softLogInfo(const string restrict txt, ...) {
-    char buf[256];
-
-    va_list list;
-    va_start(list, txt);
+    result.data = data;
+    result.size = size;
+    result.image_count = ((const SoftPackHeader*)(data))->image_count;
 
-        vsnprintf(buf, sizeof(buf), txt, list);
+    CORE.Packs.packs[CORE.Packs.count++] = result;
 
-    va_end(list);
+    softLogInfo("softLoadPack: Pack loaded successfully:");
+    softLogInfo("   > images: %u", result.image_count);
+    softLogInfo("   > size: %llu bytes", (unsigned long long)(result.size));
 
-    fprintf(stdout, "[INFO] %s\n", buf);
+    return result;
 }
 
-SAPI void softLogWarning(const string restrict txt, ...) {
-    char buf[256];
+SAPI Image softLoadImageFromPack(const Pack* pack, const string name) {
+    // The image points into the pack: no decoding and no copy.
+    Image result = { 0 };
 
-    va_list list;
-    va_start(list, txt);
+    if(!pack || !pack->data) {
+        softLogError("softLoadImageFromPack: Pack not valid. Returning...");
+        return result;
+    }
 
-        vsnprintf(buf, sizeof(buf), txt, list);
+    const SoftPackEntry* entries = (const SoftPackEntry*)(pack->data + sizeof(SoftPackHeader));
 
-    va_end(list);
+    for(u32 i = 0; i < pack->image_count; i++) {
+        if(strcmp(entries[i].name, name) == 0) {
+            result.data = (PixelBuffer)(pack->data + entries[i].offset);
+            result.size = (iVec2) { entries[i].width, entries[i].height };
+            result.channels = entries[i].channels;
 
-    fprintf(stdout, "[WARN] %s\n", buf);
+            return result;
+        }
+    }
+
+    softLogWarning("softLoadImageFromPack: Image not found: %s", name);
+
+    return result;
 }
 
-SAPI void softLogError(const string restrict txt, ...) {
-    char buf[256];
+SAPI void softUnloadPack(Pack* pack) {
+    softFlushDeferred();
 
-    va_list list;
-    va_start(list, txt);
+    if(!pack->data) {
+        softLogWarning("softUnloadPack: Trying to unload invalid pack data.");
+        return;
+    }
 
-        vsnprintf(buf, sizeof(buf), txt, list);
+    for(i32 i = 0; i < CORE.Packs.count; i++) {
+        if(CORE.Packs.packs[i].data == pack->data) {
+            CORE.Packs.packs[i] = CORE.Packs.packs[--CORE.Packs.count];
+            break;
+        }
+    }
 
-    va_end(list);
+    softUnmapFile(pack->data, pack->size);
+    *pack = (Pack) { 0 };
 
-    fprintf(stderr, "[ERR] %s\n", buf);
+    softLogInfo("softUnloadPack: Pack unloaded successfully.");
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+SAPI i32 softSavePack(const string path, const string* names, const Image* images, i32 count) {
+    if(count < 0 || (count > 0 && (!names || !images))) {
+        softLogError("softSavePack: Invalid image list. Returning...");
+        return SOFT_FAILED;
+    }
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_TEXT
-// ------------------------------------------------------
+    for(i32 i = 0; i < count; i++) {
+        if(!images[i].data || images[i].size.x <= 0 || images[i].size.y <= 0) {
+            softLogError("softSavePack: Image not valid: %s", names[i]);
+            return SOFT_FAILED;
+        }
 
-SAPI const string softTextFormat(const string restrict txt, ...) {
-    // Source: https://github.com/raysan5/raylib/blob/master/src/rtext.c#L1408
+        if(strlen(names[i]) >= SOFT_PACK_NAME_SIZE) {
+            softLogError("softSavePack: Image name too long (max. %i characters): %s", SOFT_PACK_NAME_SIZE - 1, names[i]);
+            return SOFT_FAILED;
+        }
+    }
 
-    #define CHARBUF_COUNT_TOTAL 4
+    FILE* file = fopen(path, "wb");
 
-    global char buf[CHARBUF_COUNT_TOTAL][SOFT_CHARBUF_SIZE_MAX] = { 0 };
-    global i32 buffer_index = 0;
+    if(!file) {
+        softLogError("softSavePack: %s", strerror(errno));
+        return SOFT_FAILED;
+    }
 
-    string current_buffer = buf[buffer_index];
-    SDL_memset(current_buffer, 0, SOFT_CHARBUF_SIZE_MAX * sizeof(char));
+    SoftPackHeader header = { .magic = SOFT_PACK_MAGIC, .version = SOFT_PACK_VERSION, .image_count = (u32)(count) };
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
 
-    va_list list;
-    va_start(list, txt);
+    u64 offset = sizeof(SoftPackHeader) + (u64)(count) * sizeof(SoftPackEntry);
 
-        vsnprintf(current_buffer, SOFT_CHARBUF_SIZE_MAX, txt, list);
+    for(i32 i = 0; i < count && written; i++) {
+        SoftPackEntry entry = { 0 };
 
-    va_end(list);
+        offset = (offset + SOFT_PACK_ALIGNMENT - 1) / SOFT_PACK_ALIGNMENT * SOFT_PACK_ALIGNMENT;
+        strcpy(entry.name, names[i]);
+        entry.offset = offset;
+        entry.width = images[i].size.x;
+        entry.height = images[i].size.y;
+        entry.channels = images[i].channels;
 
-    buffer_index++;
-    if(buffer_index >= CHARBUF_COUNT_TOTAL) {
-        buffer_index = 0;
+        written = fwrite(&entry, sizeof(entry), 1, file) == 1;
+        offset += (u64)(entry.width) * entry.height * sizeof(Pixel);
     }
 
-    return current_buffer;
-}
+    // The pixel data, padded up to the offsets of the entry table.
+    const u8 padding[SOFT_PACK_ALIGNMENT] = { 0 };
+    u64 position = sizeof(SoftPackHeader) + (u64)(count) * sizeof(SoftPackEntry);
 
-SAPI const bool softTextEmpty(const string restrict txt, ...) {
-    return txt[0] != '\0';
-}
+    for(i32 i = 0; i < count && written; i++) {
+        u64 pad = (SOFT_PACK_ALIGNMENT - position % SOFT_PACK_ALIGNMENT) % SOFT_PACK_ALIGNMENT;
+        u64 length = (u64)(images[i].size.x) * images[i].size.y * sizeof(Pixel);
 
-SAPI const i32 softTextLength(const string restrict txt) {
-    return SDL_strlen(txt);
+        written = fwrite(padding, 1, pad, file) == pad && fwrite(images[i].data, 1, length, file) == length;
+        position += pad + length;
+    }
+
+    if(fclose(file) != 0 || !written) {
+        softLogError("softSavePack: Pack could not be written: %s", path);
+        return SOFT_FAILED;
+    }
+
+    softLogInfo("softSavePack: Pack saved successfully:");
+    softLogInfo("   > images: %i", count);
+    softLogInfo("   > size: %llu bytes", (unsigned long long)(position));
+
+    return SOFT_SUCCESS;
 }
 
 // ------------------------------------------------------
@@ -1496,198 +8232,166 @@ SAPI const i32 softTextLength(const string restrict txt) {
 // ------------------------------------------------------
 
 // ------------------------------------------------------
-#pragma region SOFT_API_FUNC_COLOR
+#pragma region SOFT_API_FUNC_RESOURCES
 // ------------------------------------------------------
 
-SAPI Pixel softGetPixelColor(i32 x, i32 y) {
-    if(x < 0 || x >= CORE.PixelBuffer.size.x || y < 0 || y >= CORE.PixelBuffer.size.y) {
-        return BLACK;
+SAPI ImageHandle softLoadImageResource(const string path) {
+    ImageHandle result = { 0 };
+
+    if(!path) {
+        softLogError("softLoadImageResource: Path not valid. Returning...");
+        return result;
     }
 
-    return CORE.PixelBuffer.pixel_buffer[y * CORE.PixelBuffer.size.x + x];
-}
+    u32 hash = softHashPath(path);
+    i32 entry = softFindResourceEntry(path, hash);
 
-SAPI Pixel softGetPixelFromBuffer(PixelBuffer buffer, iVec2 position, iVec2 size) {
-    if(position.x < 0 || position.x >= size.x || position.y < 0 || position.y >= size.y) {
-        return BLACK;
+    // Cached: only the reference count changes.
+    if(entry >= 0) {
+        i32 slot = CORE.Resources.table[entry];
+        CORE.Resources.slots[slot].references++;
+
+        return (ImageHandle) { slot, CORE.Resources.slots[slot].generation };
     }
 
-    return buffer[position.y * size.x + position.x];
-}
+    if(!softReserveResources()) {
+        return result;
+    }
 
-SAPI Pixel softColorToPixel(Color color) {
-    Pixel result = { 0 };
+    Image image = softLoadImage(path);
+    char* key = image.data ? (char*)malloc(strlen(path) + 1) : NULL;
 
-    // NOTE: Remember about the reverse order of the bytes.
-    // This library is designed with the little endian architecture in mind!
-    // Order of the bytes is as follows: 0xAABBGGRR
-    // AA - alpha
-    // BB - blue
-    // GG - green
-    // RR - red
-    // We need to shift out bytes in the way that is compatible with the rule of endianess.
-    // RR . result.r - we don't need to shift out bits to the left
-    // GG . result.g - we need to shift to the left by 8 bits (1 byte = 1 uint8_t)
-    // BB . result.b - we need to shift to the left by 16 bits (2 bytes = 2 uint8_t's)
-    // AA . result.a - we need to shift to the left by 24 bits (3 bytes = 3 uint8_t's)
+    if(!key) {
+        if(image.data) {
+            softUnloadImage(&image);
+        }
 
-    result = 
-        color.r | 
-        color.g << 8 | 
-        color.b << 16 | 
-        color.a << 24;
+        return result;
+    }
 
-    return result;
-}
+    strcpy(key, path);
 
-SAPI Color softPixelToColor(Pixel pixel) {
-    Color result = { 0 };
+    i32 slot = CORE.Resources.free_slot - 1;
 
-    // NOTE: Remember about the reverse order of the bytes.
-    // This library is designed with the little endian architecture in mind!
-    // Order of the bytes is as follows: 0xAABBGGRR
-    // AA - alpha
-    // BB - blue
-    // GG - green
-    // RR - red
-    // When we want to get the values of our struct to the iColor variable, we need to shift our bytes correctly
-    // result.r . RR - this is our starting point, so we don't need to shidt our bytes to the right
-    // result.g . GG - we need to shift to the right by 8 bits (1 byte = 1 uint8_t)
-    // result.b . BB - we need to shift to the right by 16 bits (2 bytes = 2 uint8_t's)
-    // result.a . AA - we need to shift to the right by 24 bits (3 bytes = 3 uint8_t's)
+    if(slot >= 0) {
+        CORE.Resources.free_slot = CORE.Resources.slots[slot].next_free;
+    } else {
+        slot = CORE.Resources.slot_count++;
+        CORE.Resources.slots[slot] = (SoftResource) { .generation = 1 };
+    }
 
+    SoftResource* resource = &CORE.Resources.slots[slot];
+    resource->path = key;
+    resource->hash = hash;
+    resource->references = 1;
+    resource->next_free = 0;
+    resource->last_used = ++CORE.Resources.use_clock;
 
-    result.r = (pixel >> 8 * 0) & 0xFF;
-    result.g = (pixel >> 8 * 1) & 0xFF;
-    result.b = (pixel >> 8 * 2) & 0xFF;
-    result.a = (pixel >> 8 * 3) & 0xFF;
+    softSetResourceImage(resource, image);
+    softInsertResourceEntry(slot);
+    softEnforceImageBudget();
 
-    return result;
+    return (ImageHandle) { slot, resource->generation };
 }
 
-SAPI Color softMixColor(Color base_color, Color return_color, u8 alpha) {
-    Color result = return_color;
+SAPI Image softGetImageResource(ImageHandle handle) {
+    // Counts as a use of the image: get it every frame it's drawn, and only keep the result for that frame.
+    SoftResource* resource = softGetResource(handle);
 
-    // Check if the alpha equals 255.
-    // That means the color is opaque, so there's no need to blend it.
-    // Not every object on the screen will be opaque, so this saves a lot of computational power.
-    if(alpha == 255) {
-        return result;
-    } else if(alpha == 0) {
-        return softPixelToColor(BLANK);
+    if(!resource) {
+        softLogWarning("softGetImageResource: Invalid image handle. Returning...");
+        return (Image) { 0 };
     }
 
-    result.r = base_color.r + (return_color.r - base_color.r) * (alpha / 255.0);
-    result.g = base_color.g + (return_color.g - base_color.g) * (alpha / 255.0);
-    result.b = base_color.b + (return_color.b - base_color.b) * (alpha / 255.0);
-    result.a = alpha;
+    resource->last_used = ++CORE.Resources.use_clock;
+    resource->last_frame = CORE.Time.frame_count + 1;
 
-    return result;
+    if(!resource->image.data) {
+        softReloadResource(resource);
+    }
+
+    return resource->image;
 }
 
-SAPI Pixel softMixPixels(Pixel base_pixel, Pixel return_pixel, u8 alpha) {
-    Color base = softPixelToColor(base_pixel);
-    Color result = softPixelToColor(return_pixel);
+SAPI void softPinImageResource(ImageHandle handle, bool pinned) {
+    SoftResource* resource = softGetResource(handle);
 
-    // Check if the alpha equals 255.
-    // That means the color is opaque, so there's no need to blend it.
-    // Not every object on the screen will be opaque, so this saves a lot of computational power.
-    if(alpha == 255) {
-        return softColorToPixel(result);
-    } else if(alpha == 0) {
-        return BLANK;
+    if(!resource) {
+        softLogWarning("softPinImageResource: Invalid image handle. Returning...");
+        return;
     }
 
-    result.r = base.r + (result.r - base.r) * (alpha / 255.0);
-    result.g = base.g + (result.g - base.g) * (alpha / 255.0);
-    result.b = base.b + (result.b - base.b) * (alpha / 255.0);
-    result.a = alpha;
-
-    return softColorToPixel(result);
-}
+    resource->pinned = pinned;
 
-SAPI Color softColorFade(Color color, f32 factor) {
-    return (Color) {
-        color.r,
-        color.g,
-        color.b,
-        factor * 255
-    };
+    if(!pinned) {
+        softEnforceImageBudget();
+    }
 }
 
-SAPI Pixel softPixelFade(Pixel pixel, f32 factor) {
-    return softColorToPixel(
-        softColorFade(
-            softPixelToColor(pixel), 
-            factor
-        )
-    );
+SAPI void softSetImageBudget(u64 bytes) {
+    CORE.Resources.budget = bytes;
+    softEnforceImageBudget();
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
-
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_TIME
-// ------------------------------------------------------
-
-SAPI f32 softDeltaTime(void) {
-    return CORE.Time.delta_time;
+SAPI u64 softGetImageMemory(void) {
+    return CORE.Resources.memory_used;
 }
 
-SAPI f32 softTime(void) {
-    u32 miliseconds = SDL_GetTicks();
-    i32 second_size = 1000;
-
-    CORE.Time.application_lifetime = (f32)(miliseconds) / second_size;
+SAPI void softUnloadImageResource(ImageHandle handle) {
+    // The image is unloaded with its last reference.
+    SoftResource* resource = softGetResource(handle);
 
-    return CORE.Time.application_lifetime;
-}
+    if(!resource) {
+        softLogWarning("softUnloadImageResource: Invalid image handle. Returning...");
+        return;
+    }
 
-SAPI i32 softFPS(void) {
-    return 1 / CORE.Time.delta_time;
+    if(--resource->references == 0) {
+        softReleaseResource(handle.index);
+    }
 }
 
-SAPI void softTargetFPS(u32 framerate) {
-    CORE.Time.framerate = framerate;
-    CORE.Time.frame_target = 1.0f / framerate;
+SAPI void softRegisterImage(Image* image) {
+    // Hands an image the caller loaded itself over to softUnloadResources. Images loaded from a file should go through
+    // softLoadImageResource instead, which shares and counts them.
+    if(CORE.Resources.image_ptrs_count == CORE.Resources.image_ptrs_capacity) {
+        u32 capacity = SOFT_MAX(CORE.Resources.image_ptrs_capacity * 2, 16);
+        Image** image_ptrs = (Image**)realloc(CORE.Resources.image_ptrs, capacity * sizeof(Image*));
 
-    softLogInfo("softTargetFPS: Framerate: %iFPS (%0.04fms)", CORE.Time.framerate, CORE.Time.frame_target);
-}
+        if(!image_ptrs) {
+            softLogError("softRegisterImage: %s", strerror(errno));
+            return;
+        }
 
-SAPI void softWait(f32 seconds) {
-    SDL_Delay(seconds * 1000);
-}
+        CORE.Resources.image_ptrs = image_ptrs;
+        CORE.Resources.image_ptrs_capacity = capacity;
+    }
 
-SAPI Timer softTimer(const f32 TIME) {
-    return (Timer) {
-        TIME,
-        TIME,
-        false
-    };
+    CORE.Resources.image_ptrs[CORE.Resources.image_ptrs_count++] = image;
+    softLogInfo("softRegisterImage: New image stored in the global Image Container: %p", image);
 }
 
-SAPI void softTimerProceed(Timer* timer, f32 delta_time) {
-    if(!softTimerFinished(timer)) {
-        timer->current_time -= delta_time;
+SAPI void softUnloadResources(void) {
+    for(u32 res_index = 0; res_index < CORE.Resources.image_ptrs_count; res_index++) {
+        if(CORE.Resources.image_ptrs[res_index]->data != NULL) {
+            softLogInfo("softUnloadResources: Unloading image: %p", CORE.Resources.image_ptrs[res_index]);
+            softUnloadImage(CORE.Resources.image_ptrs[res_index]);
+        }
     }
-}
-SAPI bool softTimerFinished(Timer* timer) {
-    timer->finished = timer->current_time <= 0.0f;
 
-    return timer->finished;
-}
+    for(i32 i = 0; i < CORE.Resources.slot_count; i++) {
+        if(CORE.Resources.slots[i].references > 0) {
+            softReleaseResource(i);
+        }
+    }
 
-SAPI void softTimerRestart(Timer* timer) {
-    timer->current_time = timer->initial_time;
-    timer->finished = false;
-}
+    free(CORE.Resources.image_ptrs);
+    free(CORE.Resources.slots);
+    free(CORE.Resources.table);
 
-SAPI void softTimerReset(Timer* timer, f32 time) {
-    timer->initial_time = timer->initial_time;
-    timer->current_time = timer->initial_time;
-    timer->finished = false;
+    u64 budget = CORE.Resources.budget;
+    memset(&CORE.Resources, 0, sizeof(CORE.Resources));
+    CORE.Resources.budget = budget;
 }
 
 // ------------------------------------------------------
@@ -1695,253 +8399,411 @@ SAPI void softTimerReset(Timer* timer, f32 time) {
 // ------------------------------------------------------
 
 // ------------------------------------------------------
-#pragma region SOFT_API_FUNC_MATH
+#pragma region SOFT_API_FUNC_TILEMAP
 // ------------------------------------------------------
 
-SAPI f32 softLerpF(f32 start, f32 end, f32 t) {
-    return start + (end - start) * t;
-}
+SAPI Tilemap* softLoadTilemap(Atlas* atlas, const i32* tiles, iVec2 size, iVec2 tile_size, bool cached) {
+    // [tiles]: size.x * size.y atlas region indices, row by row (NULL: an empty map); the atlas must outlive the tilemap.
+    // Cached maps draw from pre-rendered chunks, which suits the layers that rarely change.
+    if(!atlas || size.x <= 0 || size.y <= 0 || tile_size.x <= 0 || tile_size.y <= 0) {
+        softLogError("softLoadTilemap: Invalid tilemap parameters. Returning...");
+        return NULL;
+    }
 
-SAPI f32 softPowF(f32 a, f32 n) {
-    return pow(a, n);
-}
+    Tilemap* tilemap = (Tilemap*)calloc(1, sizeof(Tilemap));
 
-SAPI f32 softSqrF(f32 a) {
-    return pow(a, 2);
-}
+    if(!tilemap) {
+        softLogError("softLoadTilemap: %s", strerror(errno));
+        return NULL;
+    }
 
-SAPI f32 softSqrtF(f32 a) {
-    return sqrt(a);
-}
+    tilemap->atlas = atlas;
+    tilemap->size = size;
+    tilemap->tile_size = tile_size;
+    tilemap->tiles = (i32*)malloc((size_t)(size.x) * size.y * sizeof(i32));
 
-SAPI i32 softLerpI(i32 start, i32 end, f32 t) {
-    return start + (end - start) * t;
-}
+    if(cached) {
+        tilemap->chunk_tiles = (iVec2) { SOFT_MAX(SOFT_TILEMAP_CHUNK_SIZE / tile_size.x, 1), SOFT_MAX(SOFT_TILEMAP_CHUNK_SIZE / tile_size.y, 1) };
+        tilemap->chunk_count = (iVec2) { (size.x + tilemap->chunk_tiles.x - 1) / tilemap->chunk_tiles.x, (size.y + tilemap->chunk_tiles.y - 1) / tilemap->chunk_tiles.y };
+        tilemap->chunks = (SoftTileChunk*)calloc((size_t)(tilemap->chunk_count.x) * tilemap->chunk_count.y, sizeof(SoftTileChunk));
+    }
 
-SAPI i32 softPowI(i32 a, i32 n) {
-    return pow(a, n);
-}
+    if(!tilemap->tiles || (cached && !tilemap->chunks)) {
+        softLogError("softLoadTilemap: %s", strerror(errno));
+        softUnloadTilemap(tilemap);
+        return NULL;
+    }
 
-SAPI i32 softSqrI(i32 a) {
-    return pow(a, 2);
-}
+    for(i32 y = 0; y < size.y; y++) {
+        for(i32 x = 0; x < size.x; x++) {
+            i32 tile = tiles ? tiles[y * size.x + x] : -1;
+            tilemap->tiles[y * size.x + x] = tile;
 
-SAPI i32 softSqrtI(i32 a) {
-    return sqrt(a);
-}
+            if(cached && tile >= 0) {
+                tilemap->chunks[y / tilemap->chunk_tiles.y * tilemap->chunk_count.x + x / tilemap->chunk_tiles.x].tile_count++;
+            }
+        }
+    }
 
-SAPI iVec2 softVectorZero(void) {
-    return (iVec2) { 0.0f, 0.0f };
-}
+    softInvalidateTilemap(tilemap);
 
-SAPI iVec2 softVectorOne(void) {
-    return (iVec2) { 1.0f, 1.0f };
+    return tilemap;
 }
 
-SAPI iVec2 softVectorUp(void) {
-    return (iVec2) { 0.0f, -1.0f };
-}
+SAPI void softSetTile(Tilemap* tilemap, iVec2 cell, i32 tile) {
+    if(!tilemap || cell.x < 0 || cell.y < 0 || cell.x >= tilemap->size.x || cell.y >= tilemap->size.y) {
+        softLogWarning("softSetTile: Invalid tilemap cell: (%i, %i). Returning...", cell.x, cell.y);
+        return;
+    }
 
-SAPI iVec2 softVectorDown(void) {
-    return (iVec2) { 0.0f, 1.0f };
-}
+    i32* current = &tilemap->tiles[cell.y * tilemap->size.x + cell.x];
 
-SAPI iVec2 softVectorLeft(void) {
-    return (iVec2) { -1.0f, 0.0f };
-}
+    if(*current == tile) {
+        return;
+    }
 
-SAPI iVec2 softVectorRight(void) {
-    return (iVec2) { 1.0f, 0.0f };
-}
+    // Only the chunk holding the cell is rendered again.
+    if(tilemap->chunks) {
+        SoftTileChunk* chunk = &tilemap->chunks[cell.y / tilemap->chunk_tiles.y * tilemap->chunk_count.x + cell.x / tilemap->chunk_tiles.x];
 
-SAPI iVec2 softVectorAdd(iVec2 a, iVec2 b) {
-    return (iVec2) { a.x + b.x, a.y + b.y };
-}
+        chunk->tile_count += (tile >= 0) - (*current >= 0);
+        chunk->dirty = true;
+    }
 
-SAPI iVec2 softVectorSub(iVec2 a, iVec2 b) {
-    return (iVec2) { a.x - b.x, a.y - b.y };
+    *current = tile;
 }
 
-SAPI iVec2 softVectorMult(iVec2 a, iVec2 b) {
-    return (iVec2) { a.x * b.x, a.y * b.y };
-}
+SAPI i32 softGetTile(Tilemap* tilemap, iVec2 cell) {
+    if(!tilemap || cell.x < 0 || cell.y < 0 || cell.x >= tilemap->size.x || cell.y >= tilemap->size.y) {
+        return -1;
+    }
 
-SAPI iVec2 softVectorMultFactor(iVec2 a, f32 factor) {
-    return (iVec2) { a.x * factor, a.y * factor };
+    return tilemap->tiles[cell.y * tilemap->size.x + cell.x];
 }
 
-SAPI iVec2 softVectorDiv(iVec2 a, iVec2 b) {
-    return (iVec2) { a.x / b.x, a.y / b.y };
-}
+SAPI void softInvalidateTilemap(Tilemap* tilemap) {
+    // Renders every chunk again on its next draw; call it after changing the atlas pixels.
+    if(!tilemap || !tilemap->chunks) {
+        return;
+    }
 
-SAPI iVec2 softVectorDivFactor(iVec2 a, f32 factor) {
-    return (iVec2) { a.x / factor, a.y / factor };
+    for(i32 i = 0; i < tilemap->chunk_count.x * tilemap->chunk_count.y; i++) {
+        tilemap->chunks[i].dirty = true;
+    }
 }
 
-SAPI iVec2 softVectorLerp(iVec2 start, iVec2 end, f32 t) {
-    return (iVec2) {
-        softLerpI(start.x, end.x, t),
-        softLerpI(start.y, end.y, t)
-    };
-}
+SAPI void softDrawTilemap(Tilemap* tilemap, iVec2 position, Pixel tint) {
+    // [position]: the top-left corner of the map (world space in 2D mode); without a camera, scroll by moving it.
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softDrawTilemap: Pixel buffer not valid. Returning...");
+        return;
+    }
 
-SAPI bool softVectorCompare(iVec2 a, iVec2 b) {
-    return a.x == b.x && a.y == b.y;
-}
+    if(!tilemap) {
+        return;
+    }
 
-SAPI Color softColorZero(void) {
-    return (Color) { 0, 0, 0, 0 };
-}
+    SoftBounds cells = softGetVisibleCells(position, tilemap->tile_size, tilemap->size);
 
-SAPI Color softColorOne(void) {
-    return (Color) { 1, 1, 1, 1 };
-}
+    if(!tilemap->chunks) {
+        for(i32 y = cells.y0; y < cells.y1; y++) {
+            for(i32 x = cells.x0; x < cells.x1; x++) {
+                softDrawTile(tilemap, position, x, y, tint);
+            }
+        }
 
-SAPI Color softColorAdd(Color a, Color b) {
-    return (Color) { 
-        a.r + b.r, 
-        a.g + b.g, 
-        a.b + b.b, 
-        a.a + b.a
-    };
-}
+        return;
+    }
 
-SAPI Color softColorSub(Color a, Color b) {
-    return (Color) { 
-        a.r - b.r, 
-        a.g - b.g, 
-        a.b - b.b, 
-        a.a - b.a
-    };
-}
+    iVec2 chunk_size = softVectorMult(tilemap->tile_size, tilemap->chunk_tiles);
+    SoftBounds chunks = softGetVisibleCells(position, chunk_size, tilemap->chunk_count);
 
-SAPI Color softColorMult(Color a, Color b) {
-    return (Color) { 
-        a.r * b.r, 
-        a.g * b.g, 
-        a.b * b.b, 
-        a.a * b.a
-    };
-}
+    // Under BLEND_REPLACE the uncovered pixels of a chunk would erase what's below the layer: those chunks go tile by tile.
+    bool replace = CORE.Config.blend_mode == BLEND_REPLACE;
+    bool partial = false;
 
-SAPI Color softColorDiv(Color a, Color b) {
-    return (Color) { 
-        a.r / b.r, 
-        a.g / b.g, 
-        a.b / b.b, 
-        a.a / b.a
-    };
-}
+    for(i32 y = chunks.y0; y < chunks.y1; y++) {
+        for(i32 x = chunks.x0; x < chunks.x1; x++) {
+            SoftTileChunk* chunk = &tilemap->chunks[y * tilemap->chunk_count.x + x];
 
-SAPI Color softColorLerp(Color start, Color end, f32 t) {
-    return (Color) { 
-        softLerpI(start.r, end.r, t), 
-        softLerpI(start.g, end.g, t), 
-        softLerpI(start.b, end.b, t), 
-        softLerpI(start.a, end.a, t)
-    };
-}
+            if(chunk->tile_count == 0 || (chunk->dirty && !softRenderTileChunk(tilemap, x, y))) {
+                continue;
+            }
 
-SAPI bool softColorCompare(Color a, Color b) {
-    return 
-        (a.r == b.r) &&
-        (a.g == b.g) &&
-        (a.b == b.b) &&
-        (a.a == b.a);
-}
+            if(replace && !chunk->full) {
+                partial = true;
+                continue;
+            }
 
-SAPI bool softPixelCompare(Pixel a, Pixel b) {
-    return a == b;
+            softDrawImage(&chunk->image, (iVec2) { position.x + x * chunk_size.x, position.y + y * chunk_size.y }, tint);
+        }
+    }
+
+    if(!partial) {
+        return;
+    }
+
+    // Whole rows of cells at a time: going chunk by chunk is noticeably harder on the cache.
+    for(i32 y = cells.y0; y < cells.y1; y++) {
+        const SoftTileChunk* row = &tilemap->chunks[y / tilemap->chunk_tiles.y * tilemap->chunk_count.x];
+
+        for(i32 x = cells.x0; x < cells.x1; x++) {
+            if(!row[x / tilemap->chunk_tiles.x].full) {
+                softDrawTile(tilemap, position, x, y, tint);
+            }
+        }
+    }
 }
 
+SAPI void softUnloadTilemap(Tilemap* tilemap) {
+    if(!tilemap) {
+        softLogWarning("softUnloadTilemap: Trying to unload an invalid tilemap.");
+        return;
+    }
+
+    if(tilemap->chunks) {
+        for(i32 i = 0; i < tilemap->chunk_count.x * tilemap->chunk_count.y; i++) {
+            if(tilemap->chunks[i].image.data) {
+                softUnloadImage(&tilemap->chunks[i].image);
+            }
+        }
+    }
+
+    free(tilemap->chunks);
+    free(tilemap->tiles);
+    free(tilemap);
+}
 
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
 
 // ------------------------------------------------------
-#pragma region SOFT_API_FUNC_IMAGE
+#pragma region SOFT_API_FUNC_RECORDING
 // ------------------------------------------------------
 
-SAPI Image softLoadImage(const string path) {
-    Image result = { 0 };
-
-    stbi_uc* data = stbi_load(
-        path, 
-        &result.size.x, 
-        &result.size.y, 
-        &result.channels, 
-        STBI_rgb_alpha
-    );
-
-    if(!data) {
-        softLogError("Image loading failure: %s", stbi_failure_reason());
-        return result;
+SAPI i32 softBeginRecording(const string path) {
+    // From here on, every draw call is written to [path] with its arguments and the state it was made with, and every softBlit ends a frame.
+    // Images are compared with their last recorded content (once per frame), so recording costs a copy of every image drawn.
+    if(CORE.Recording.file) {
+        softLogWarning("softBeginRecording: Already recording. Returning...");
+        return SOFT_FAILED;
     }
 
-    result.data = (PixelBuffer)calloc(result.size.x * result.size.y, sizeof(Pixel));
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softLogError("softBeginRecording: Pixel buffer not valid. Returning...");
+        return SOFT_FAILED;
+    }
 
-    for(i32 index_source = 0, index_result = 0; index_source < result.size.x * result.size.y * result.channels * sizeof(stbi_uc) && index_result < result.size.x * result.size.y * sizeof(Pixel); index_result++) {
-        Color pixel_color = { 0 };
-        pixel_color.r = data[index_source++];
-        pixel_color.g = data[index_source++];
-        pixel_color.b = data[index_source++];
-        pixel_color.a = data[index_source++];
+    FILE* file = fopen(path, "wb");
 
-        result.data[index_result] = softColorToPixel(pixel_color);
+    if(!file) {
+        softLogError("softBeginRecording: %s", strerror(errno));
+        return SOFT_FAILED;
     }
 
-    stbi_image_free(data);
+    SoftRecordingHeader header = { SOFT_RECORDING_MAGIC, SOFT_RECORDING_VERSION, CORE.PixelBuffer.size.x, CORE.PixelBuffer.size.y };
 
-    softLogInfo("softLoadImage: Image loaded successfully:");
-    softLogInfo("   > resolution: %ix%ipx", result.size.x, result.size.y);
-    softLogInfo("   > channels: %i", result.channels);
-    softLogInfo("   > size: %i bytes", result.size.x * result.size.y * sizeof(Pixel));
+    if(fwrite(&header, sizeof(header), 1, file) != 1) {
+        softLogError("softBeginRecording: Recording could not be written: %s", path);
+        fclose(file);
+        return SOFT_FAILED;
+    }
 
-    return result;
+    softCloseRecording();
+    CORE.Recording.file = file;
+
+    softLogInfo("softBeginRecording: Recording draw calls to: %s", path);
+    return SOFT_SUCCESS;
 }
 
-SAPI void softUnloadImage(Image* image) {
-    if(image->data == NULL) {
-        softLogWarning("softUnloadImage: Trying to unload invalid image data.");
+SAPI void softEndRecording(void) {
+    if(!CORE.Recording.file) {
+        softLogWarning("softEndRecording: Not recording. Returning...");
         return;
     }
 
-    free(image->data);
-    softLogInfo("softUnloadImage: Image unloaded successfully.");
+    bool written = fclose(CORE.Recording.file) == 0 && !CORE.Recording.failed;
+    u64 frames = CORE.Recording.frame;
+    softCloseRecording();
+
+    if(!written) {
+        softLogError("softEndRecording: Recording could not be written completely.");
+        return;
+    }
+
+    softLogInfo("softEndRecording: Recording saved (%llu frames).", (unsigned long long)(frames));
 }
 
-// ------------------------------------------------------
-#pragma endregion
-// ------------------------------------------------------
+SAPI i32 softReplayRecording(const string path, f32* frame_times, i32 capacity) {
+    // Draws a recording again as fast as possible, without presenting anything, and returns the number of frames it had.
+    // The time of every frame (in seconds) goes to [frame_times], up to [capacity] of them (may be NULL).
+    // The frames are drawn into the current pixel buffer; without one (i.e. without a window), a buffer of the recorded size is made current.
+    FILE* file = fopen(path, "rb");
 
-// ------------------------------------------------------
-#pragma region SOFT_API_FUNC_RESOURCES
-// ------------------------------------------------------
+    if(!file) {
+        softLogError("softReplayRecording: %s", strerror(errno));
+        return 0;
+    }
 
-SAPI void softLoadResourceImage(Image* image) {
-    if(CORE.Resources.image_ptrs == NULL) {
-        softLogInfo("softLoadResourceImage: Initializing the global Image Container.");
-        CORE.Resources.image_ptrs = (Image**)calloc(1, sizeof(Image));
-        CORE.Resources.image_ptrs_count = 1;
-    } else {
-        CORE.Resources.image_ptrs = (Image**)realloc(CORE.Resources.image_ptrs, (CORE.Resources.image_ptrs_count + 1) * sizeof(Image));
-        CORE.Resources.image_ptrs_count++;
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    SoftReplay replay = { 0 };
+    replay.data = length > 0 ? (u8*)malloc(length) : NULL;
+    replay.size = length > 0 ? (size_t)(length) : 0;
+
+    if(!replay.data || fread(replay.data, 1, length, file) != (size_t)(length)) {
+        softLogError("softReplayRecording: Recording could not be read: %s", path);
+        fclose(file);
+        free(replay.data);
+        return 0;
     }
 
-    CORE.Resources.image_ptrs[CORE.Resources.image_ptrs_count - 1] = image;
-    softLogInfo("softLoadResourceImage: New image stored in the global Image Container: %p", image);
-}
+    fclose(file);
 
-SAPI void softUnloadResources(void) {
-    for(int res_index = 0; res_index < CORE.Resources.image_ptrs_count; res_index++) {
-        if(CORE.Resources.image_ptrs != NULL && CORE.Resources.image_ptrs[res_index]->data != NULL) {
-            softLogInfo("softUnloadResources: Unloading image: %p", CORE.Resources.image_ptrs[res_index]);
-            softUnloadImage(CORE.Resources.image_ptrs[res_index]);
+    SoftRecordingHeader header;
+
+    if(!SOFT_READ_VALUE(&replay, header) || header.magic != SOFT_RECORDING_MAGIC || header.version != SOFT_RECORDING_VERSION) {
+        softLogError("softReplayRecording: Not a recording (or an unsupported version): %s", path);
+        free(replay.data);
+        return 0;
+    }
+
+    if(!CORE.PixelBuffer.pixel_buffer) {
+        softSetCurrentPixelBuffer(softCreatePixelBuffer(header.width, header.height));
+    } else if(CORE.PixelBuffer.size.x != header.width || CORE.PixelBuffer.size.y != header.height) {
+        softLogWarning("softReplayRecording: Recorded at %ix%ipx, replaying at %ix%ipx.", header.width, header.height, CORE.PixelBuffer.size.x, CORE.PixelBuffer.size.y);
+    }
+
+    // Every recording starts with a state record; the caller's state is restored afterwards.
+    SoftRecordState state = softGetRecordState();
+    SoftBounds clip_stack[SOFT_CLIP_STACK_SIZE_MAX];
+    i32 clip_count = CORE.Clip.count;
+
+    memcpy(clip_stack, CORE.Clip.stack, sizeof(clip_stack));
+    softFlushDeferred();
+
+    CORE.Recording.depth++;
+
+    // The points of the calls (and the queued text) live in the frame arena until the end of their frame.
+    SoftArenaMark mark = softFrameMark();
+    u64 frequency = SDL_GetPerformanceFrequency();
+    u64 frame_start = SDL_GetPerformanceCounter();
+    i32 frames = 0;
+
+    while(replay.offset < replay.size && !replay.failed) {
+        u8 type = 0;
+        SOFT_READ_VALUE(&replay, type);
+
+        Rect rect, source;
+        Line line;
+        Circle circle;
+        Triangle triangle;
+        iVec2 a, b, c, d;
+        iVec2* points;
+        i32 count, dx, dy;
+        f32 value;
+        Pixel pixel, pixel_b, pixel_c;
+        Image* image;
+        Font* font;
+        string text;
+        SoftImageFlip flip;
+
+        switch(type) {
+            case SOFT_CALL_FRAME: {
+                softFlushDeferred();
+
+                u64 frame_end = SDL_GetPerformanceCounter();
+
+                if(frame_times && frames < capacity) {
+                    frame_times[frames] = (f32)((d32)(frame_end - frame_start) / frequency);
+                }
+
+                frames++;
+                softFrameRelease(mark);
+                frame_start = SDL_GetPerformanceCounter();
+            } break;
+
+            case SOFT_CALL_STATE: softReplayState(&replay); break;
+
+            case SOFT_CALL_CLEAR: softClearBuffer(); break;
+            case SOFT_CALL_CLEAR_COLOR: if(SOFT_READ_VALUE(&replay, pixel)) softClearBufferColor(pixel); break;
+            case SOFT_CALL_SCROLL: if(SOFT_READ_VALUE(&replay, dx) && SOFT_READ_VALUE(&replay, dy) && SOFT_READ_VALUE(&replay, pixel)) softScrollBuffer(dx, dy, pixel, NULL); break;
+
+            case SOFT_CALL_RECTANGLE: if(SOFT_READ_VALUE(&replay, rect) && SOFT_READ_VALUE(&replay, pixel)) softDrawRectangle(rect, pixel); break;
+            case SOFT_CALL_RECTANGLE_LINES: if(SOFT_READ_VALUE(&replay, rect) && SOFT_READ_VALUE(&replay, pixel)) softDrawRectangleLines(rect, pixel); break;
+            case SOFT_CALL_RECTANGLE_EX: if(SOFT_READ_VALUE(&replay, rect) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, pixel)) softDrawRectangleEx(rect, a, pixel); break;
+            case SOFT_CALL_RECTANGLE_ROTATED: if(SOFT_READ_VALUE(&replay, rect) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawRectangleRotated(rect, a, value, pixel); break;
+
+            case SOFT_CALL_LINE: if(SOFT_READ_VALUE(&replay, line) && SOFT_READ_VALUE(&replay, pixel)) softDrawLine(line, pixel); break;
+            case SOFT_CALL_LINE_AA: if(SOFT_READ_VALUE(&replay, line) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineAA(line, pixel); break;
+            case SOFT_CALL_LINE_STRIP: if(softReplayPoints(&replay, &points, &count) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineStrip(points, count, pixel); break;
+            case SOFT_CALL_LINE_BEZIER: if(SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, c) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineBezier(a, b, c, pixel); break;
+            case SOFT_CALL_LINE_BEZIER_CUBIC: if(SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, c) && SOFT_READ_VALUE(&replay, d) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineBezierCubic(a, b, c, d, pixel); break;
+
+            case SOFT_CALL_CIRCLE: if(SOFT_READ_VALUE(&replay, circle) && SOFT_READ_VALUE(&replay, pixel)) softDrawCircle(circle, pixel); break;
+            case SOFT_CALL_CIRCLE_LINES: if(SOFT_READ_VALUE(&replay, circle) && SOFT_READ_VALUE(&replay, pixel)) softDrawCircleLines(circle, pixel); break;
+            case SOFT_CALL_CIRCLE_AA: if(SOFT_READ_VALUE(&replay, circle) && SOFT_READ_VALUE(&replay, pixel)) softDrawCircleAA(circle, pixel); break;
+            case SOFT_CALL_CIRCLE_LINES_AA: if(SOFT_READ_VALUE(&replay, circle) && SOFT_READ_VALUE(&replay, pixel)) softDrawCircleLinesAA(circle, pixel); break;
+
+            case SOFT_CALL_TRIANGLE: if(SOFT_READ_VALUE(&replay, triangle) && SOFT_READ_VALUE(&replay, pixel)) softDrawTriangle(triangle, pixel); break;
+            case SOFT_CALL_TRIANGLE_LINES: if(SOFT_READ_VALUE(&replay, triangle) && SOFT_READ_VALUE(&replay, pixel)) softDrawTriangleLines(triangle, pixel); break;
+            case SOFT_CALL_TRIANGLE_COLORS: if(SOFT_READ_VALUE(&replay, triangle) && SOFT_READ_VALUE(&replay, pixel) && SOFT_READ_VALUE(&replay, pixel_b) && SOFT_READ_VALUE(&replay, pixel_c)) softDrawTriangleColors(triangle, pixel, pixel_b, pixel_c); break;
+            case SOFT_CALL_TRIANGLE_TEXTURED: if(SOFT_READ_VALUE(&replay, triangle) && softReplayImage(&replay, &image) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, c) && SOFT_READ_VALUE(&replay, pixel)) softDrawTriangleTextured(triangle, image, a, b, c, pixel); break;
+
+            case SOFT_CALL_POLYGON: if(softReplayPoints(&replay, &points, &count) && SOFT_READ_VALUE(&replay, pixel)) softDrawPolygon(points, count, pixel); break;
+
+            case SOFT_CALL_LINE_STROKE: if(SOFT_READ_VALUE(&replay, line) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineStroke(line, value, pixel); break;
+            case SOFT_CALL_LINE_STRIP_STROKE: if(softReplayPoints(&replay, &points, &count) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineStripStroke(points, count, value, pixel); break;
+            case SOFT_CALL_LINE_BEZIER_STROKE: if(SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, c) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineBezierStroke(a, b, c, value, pixel); break;
+            case SOFT_CALL_LINE_BEZIER_CUBIC_STROKE: if(SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, c) && SOFT_READ_VALUE(&replay, d) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawLineBezierCubicStroke(a, b, c, d, value, pixel); break;
+            case SOFT_CALL_POLYGON_STROKE: if(softReplayPoints(&replay, &points, &count) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawPolygonStroke(points, count, value, pixel); break;
+            case SOFT_CALL_RECTANGLE_STROKE: if(SOFT_READ_VALUE(&replay, rect) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawRectangleStroke(rect, value, pixel); break;
+            case SOFT_CALL_CIRCLE_STROKE: if(SOFT_READ_VALUE(&replay, circle) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawCircleStroke(circle, value, pixel); break;
+
+            case SOFT_CALL_TEXT: if(softReplayFont(&replay, &font) && softReplayText(&replay, &text) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, pixel)) softDrawTextEx(font, text, a, pixel); break;
+
+            case SOFT_CALL_IMAGE: if(softReplayImage(&replay, &image) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, flip) && SOFT_READ_VALUE(&replay, pixel)) softDrawImageEx(image, a, b, flip, pixel); break;
+            case SOFT_CALL_IMAGE_ROTATED: if(softReplayImage(&replay, &image) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, b) && SOFT_READ_VALUE(&replay, value) && SOFT_READ_VALUE(&replay, pixel)) softDrawImageRotated(image, a, b, value, pixel); break;
+            case SOFT_CALL_IMAGE_PRO: if(softReplayImage(&replay, &image) && SOFT_READ_VALUE(&replay, source) && SOFT_READ_VALUE(&replay, rect) && SOFT_READ_VALUE(&replay, pixel)) softDrawImagePro(image, source, rect, pixel); break;
+            case SOFT_CALL_IMAGE_REC: if(softReplayImage(&replay, &image) && SOFT_READ_VALUE(&replay, source) && SOFT_READ_VALUE(&replay, a) && SOFT_READ_VALUE(&replay, pixel)) softDrawImageRec(image, source, a, pixel); break;
+
+            default: replay.failed = true; break;
         }
     }
 
-    free(CORE.Resources.image_ptrs);
+    if(replay.failed) {
+        softLogError("softReplayRecording: Recording data not valid (at byte %llu): %s", (unsigned long long)(replay.offset), path);
+    }
+
+    // Nothing queued may outlive the images and fonts it points to.
+    softFlushDeferred();
+    softFrameRelease(mark);
+
+    CORE.Recording.depth--;
+    CORE.Deferred.active = false;
+    softSetRecordState(&state);
+
+    memcpy(CORE.Clip.stack, clip_stack, sizeof(clip_stack));
+    CORE.Clip.count = clip_count;
+
+    for(i32 i = 0; i < replay.image_count; i++) {
+        free(replay.images[i].data);
+        free(replay.images[i].runs);
+    }
+
+    for(i32 i = 0; i < replay.font_count; i++) {
+        free(replay.fonts[i]->atlas);
+        free(replay.fonts[i]);
+    }
+
+    free(replay.images);
+    free(replay.fonts);
+    free(replay.data);
+
+    return frames;
 }
 
 // ------------------------------------------------------
@@ -17,6 +17,7 @@
 // - SOFT_FUNC_EVENTS;
 // - SOFT_FUNC_INPUT;
 // - SOFT_FUNC_RENDER;
+// - SOFT_FUNC_MEMORY;
 // - SOFT_FUNC_DRAW;
 // - SOFT_FUNC_LOGGING;
 // - SOFT_FUNC_TEXT;
@@ -26,6 +27,10 @@
 // - SOFT_MACROS_MATH;
 // - SOFT_FUNC_MATH;
 // - SOFT_FUNC_IMAGE;
+// - SOFT_FUNC_FONT;
+// - SOFT_FUNC_PACK;
+// - SOFT_FUNC_TILEMAP;
+// - SOFT_FUNC_RECORDING;
 // ---------------------------------------------------------------------------------
 // External Dependencies:
 // - SDL2: https://github.com/libsdl-org/SDL.git
@@ -74,6 +79,7 @@
 // Standard library headers
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 // ------------------------------------------------------
 #pragma endregion
@@ -94,6 +100,9 @@
 #define SOFT_SUCCESS 0
 #define SOFT_FAILED 1
 
+#define SOFT_FONT_GLYPH_FIRST 32    // Fonts hold the printable ASCII range
+#define SOFT_FONT_GLYPH_COUNT 95
+
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
@@ -108,6 +117,8 @@ typedef uint32_t                 u32;
 typedef int8_t                   i8;
 typedef int16_t                  i16;
 typedef int                      i32;
+typedef int64_t                  i64;
+typedef uint64_t                 u64;
 typedef float                    f32;
 typedef double                   d32;
 typedef char*                    string;
@@ -119,8 +130,19 @@ typedef struct { u8 r; u8 g; u8 b; u8 a; }                                  Colo
 typedef struct { iVec2 position; iVec2 size; }                              Rect;
 typedef struct { iVec2 position; i32 r; }                                   Circle;
 typedef struct { iVec2 a; iVec2 b; }                                        Line;
+typedef struct { iVec2 a; iVec2 b; iVec2 c; }                              Triangle;
 typedef struct { f32 initial_time; f32 current_time; bool finished; }       Timer;
-typedef struct { PixelBuffer data; iVec2 size; i32 channels; }                      Image;
+typedef struct { f32 p50; f32 p95; f32 p99; f32 max; i32 samples; }         FrameTimes;
+typedef struct { PixelBuffer data; iVec2 size; i32 channels; u32* runs; }          Image;
+typedef struct { iVec2 offset; iVec2 target; f32 rotation; f32 zoom; }      Camera2D;
+typedef struct { iVec2 position; iVec2 size; iVec2 offset; i32 advance; }   Glyph;
+typedef struct ImageJob                                                     ImageJob;
+typedef struct { u8* data; u64 size; u32 image_count; }                     Pack;
+typedef struct { u32 index; u32 generation; }                               ImageHandle;
+typedef struct { i32 page; Rect rect; }                                     AtlasRegion;
+typedef struct { Image* pages; i32 page_count; AtlasRegion* regions; i32 region_count; } Atlas;
+typedef struct Tilemap                                                      Tilemap;
+typedef struct { u8* atlas; iVec2 atlas_size; Glyph glyphs[SOFT_FONT_GLYPH_COUNT]; i32 line_height; } Font;
 
 // ------------------------------------------------------
 #pragma endregion
@@ -303,6 +325,45 @@ typedef enum {
     FLIP_HV
 } SoftImageFlip;
 
+typedef enum {
+    BLEND_REPLACE = 0,          // dst = src
+    BLEND_ALPHA,                // dst = src * a + dst * (1 - a)
+    BLEND_ALPHA_PREMULTIPLIED,  // dst = src + dst * (1 - a)
+    BLEND_ADDITIVE,             // dst = dst + src * a
+    BLEND_MULTIPLY,             // dst = dst * src (weighted by a)
+    BLEND_SCREEN,               // dst = 1 - (1 - dst) * (1 - src) (weighted by a)
+    BLEND_COLOR_KEY,            // dst = src, except for BLANK pixels, which are skipped (softAlphaBlendState(false))
+    BLEND_COUNT
+} SoftBlendMode;
+
+typedef enum {
+    FILTER_NEAREST = 0,
+    FILTER_BILINEAR
+} SoftImageFilter;
+
+typedef enum {
+    DEBUG_VIEW_NONE = 0,
+    DEBUG_VIEW_OVERDRAW,        // Writes per pixel: blue (1), green, yellow, orange, red, pink, magenta, white (8 or more)
+    DEBUG_VIEW_BLENDING         // Blended share of the writes per pixel: green (none) to red (all)
+} SoftDebugView;
+
+typedef enum {
+    FILL_NONZERO = 0,           // Inside where the winding number is not zero
+    FILL_EVEN_ODD               // Inside where an odd number of edges is crossed
+} SoftFillRule;
+
+typedef enum {
+    JOIN_MITER = 0,             // Sharp corner (a bevel past the miter limit)
+    JOIN_ROUND,
+    JOIN_BEVEL
+} SoftLineJoin;
+
+typedef enum {
+    CAP_BUTT = 0,               // Ends exactly at the endpoint
+    CAP_ROUND,
+    CAP_SQUARE                  // Extends past the endpoint by half of the width
+} SoftLineCap;
+
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
@@ -312,6 +373,17 @@ typedef enum {
 // ------------------------------------------------------
 
 SAPI void softAlphaBlendState(bool state);
+SAPI void softSetBlendMode(SoftBlendMode mode);
+SAPI SoftBlendMode softGetBlendMode(void);
+SAPI void softSetImageFilter(SoftImageFilter filter);
+SAPI void softSetFillRule(SoftFillRule rule);
+SAPI SoftFillRule softGetFillRule(void);
+SAPI void softSetLineJoin(SoftLineJoin join);
+SAPI SoftLineJoin softGetLineJoin(void);
+SAPI void softSetLineCap(SoftLineCap cap);
+SAPI SoftLineCap softGetLineCap(void);
+SAPI void softSetImageRunEncoding(bool state);
+SAPI bool softGetImageRunEncoding(void);
 
 // ------------------------------------------------------
 #pragma endregion
@@ -391,8 +463,34 @@ SAPI bool softMouseButtonUp(softMouseButtons button);
 
 SAPI void softClearBuffer(void);
 SAPI void softClearBufferColor(Pixel pixel);
+SAPI i32 softScrollBuffer(i32 dx, i32 dy, Pixel fill, Rect* exposed);
 SAPI void softBlit(void);
 
+SAPI void softPushClipRect(Rect rect);
+SAPI void softPopClipRect(void);
+SAPI Rect softGetClipRect(void);
+
+SAPI void softBeginMode2D(Camera2D camera);
+SAPI void softEndMode2D(void);
+SAPI void softBeginDeferred(void);
+SAPI void softEndDeferred(void);
+SAPI iVec2 softGetWorldToScreen2D(iVec2 position, Camera2D camera);
+SAPI iVec2 softGetScreenToWorld2D(iVec2 position, Camera2D camera);
+SAPI void softSetDebugView(SoftDebugView view);
+SAPI SoftDebugView softGetDebugView(void);
+SAPI f32 softGetOverdraw(void);
+SAPI f32 softGetBlendRatio(void);
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_FUNC_MEMORY
+// ------------------------------------------------------
+
+SAPI void* softFrameAlloc(size_t size);
+
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
@@ -404,15 +502,43 @@ SAPI void softBlit(void);
 SAPI void softDrawRectangle(Rect rect, Pixel pixel);
 SAPI void softDrawRectangleLines(Rect rect, Pixel pixel);
 SAPI void softDrawRectangleEx(Rect rect, iVec2 pivot, Pixel pixel);
+SAPI void softDrawRectangleRotated(Rect rect, iVec2 pivot, f32 rotation, Pixel pixel);
 
 SAPI void softDrawLine(Line line, Pixel pixel);
-SAPI void softDrawLineBezier(iVec2 start, iVec2 end, iVec2 midpoint, i32 resolution, Pixel pixel);
+SAPI void softDrawLineAA(Line line, Pixel pixel);
+SAPI void softDrawLineStrip(const iVec2* points, i32 count, Pixel pixel);
+SAPI void softDrawLineBezier(iVec2 start, iVec2 end, iVec2 midpoint, Pixel pixel);
+SAPI void softDrawLineBezierCubic(iVec2 start, iVec2 end, iVec2 control_start, iVec2 control_end, Pixel pixel);
 
 SAPI void softDrawCircle(Circle circle, Pixel pixel);
 SAPI void softDrawCircleLines(Circle circle, Pixel pixel);
+SAPI void softDrawCircleAA(Circle circle, Pixel pixel);
+SAPI void softDrawCircleLinesAA(Circle circle, Pixel pixel);
+
+SAPI void softDrawTriangle(Triangle triangle, Pixel pixel);
+SAPI void softDrawTriangleLines(Triangle triangle, Pixel pixel);
+SAPI void softDrawTriangleColors(Triangle triangle, Pixel pixel_a, Pixel pixel_b, Pixel pixel_c);
+SAPI void softDrawTriangleTextured(Triangle triangle, Image* image, iVec2 uv_a, iVec2 uv_b, iVec2 uv_c, Pixel tint);
+
+SAPI void softDrawPolygon(const iVec2* points, i32 count, Pixel pixel);
+
+SAPI void softDrawLineStroke(Line line, f32 width, Pixel pixel);
+SAPI void softDrawLineStripStroke(const iVec2* points, i32 count, f32 width, Pixel pixel);
+SAPI void softDrawLineBezierStroke(iVec2 start, iVec2 end, iVec2 midpoint, f32 width, Pixel pixel);
+SAPI void softDrawLineBezierCubicStroke(iVec2 start, iVec2 end, iVec2 control_start, iVec2 control_end, f32 width, Pixel pixel);
+SAPI void softDrawPolygonStroke(const iVec2* points, i32 count, f32 width, Pixel pixel);
+SAPI void softDrawRectangleStroke(Rect rect, f32 width, Pixel pixel);
+SAPI void softDrawCircleStroke(Circle circle, f32 width, Pixel pixel);
+
+SAPI void softDrawText(const string text, iVec2 position, i32 size, Pixel tint);
+SAPI void softDrawTextEx(Font* font, const string text, iVec2 position, Pixel tint);
 
 SAPI void softDrawImage(Image* image, iVec2 position, Pixel tint);
 SAPI void softDrawImageEx(Image* image, iVec2 position, iVec2 pivot, SoftImageFlip image_flip, Pixel tint);
+SAPI void softDrawImagePro(Image* image, Rect source, Rect dest, Pixel tint);
+SAPI void softDrawImageRec(Image* image, Rect source, iVec2 position, Pixel tint);
+SAPI void softDrawAtlasRegion(Atlas* atlas, i32 index, iVec2 position, Pixel tint);
+SAPI void softDrawImageRotated(Image* image, iVec2 position, iVec2 pivot, f32 rotation, Pixel tint);
 
 // ------------------------------------------------------
 #pragma endregion
@@ -439,6 +565,9 @@ SAPI const string softTextFormat(const string restrict txt, ...);
 SAPI const bool softTextEmpty(const string restrict txt, ...);
 SAPI const i32 softTextLength(const string restrict txt);
 
+SAPI iVec2 softMeasureText(const string text, i32 size);
+SAPI iVec2 softMeasureTextEx(Font* font, const string text);
+
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
@@ -486,6 +615,8 @@ SAPI Pixel softPixelFade(Pixel pixel, f32 factor);
 SAPI f32 softDeltaTime(void);
 SAPI f32 softTime(void);
 SAPI i32 softFPS(void);
+SAPI FrameTimes softGetFrameTimePercentiles(void);
+SAPI void softDrawFrameTimeGraph(Rect area);
 SAPI void softTargetFPS(u32 framerate);
 SAPI void softWait(f32 seconds);
 
@@ -558,21 +689,84 @@ SAPI bool softPixelCompare(Pixel a, Pixel b);
 // ------------------------------------------------------
 
 SAPI Image softLoadImage(const string path);
+SAPI ImageJob* softLoadImageAsync(const string path);
+SAPI bool softImageReady(ImageJob* job);
+SAPI Image softWaitImage(ImageJob* job);
+SAPI void softEncodeImageRuns(Image* image);
+SAPI Atlas softLoadAtlas(const Image* images, i32 count, iVec2 page_size);
+SAPI void softUnloadAtlas(Atlas* atlas);
 SAPI void softUnloadImage(Image* image);
 
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
 
+// ------------------------------------------------------
+#pragma region SOFT_FUNC_FONT
+// ------------------------------------------------------
+
+SAPI Font softLoadFont(const string path, i32 size);
+SAPI void softUnloadFont(Font* font);
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_FUNC_PACK
+// ------------------------------------------------------
+
+SAPI Pack softLoadPack(const string path);
+SAPI Image softLoadImageFromPack(const Pack* pack, const string name);
+SAPI void softUnloadPack(Pack* pack);
+SAPI i32 softSavePack(const string path, const string* names, const Image* images, i32 count);
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
 // ------------------------------------------------------
 #pragma region SOFT_FUNC_RESOURCES
 // ------------------------------------------------------
 
-SAPI void softLoadResourceImage(Image* image);
+SAPI ImageHandle softLoadImageResource(const string path);
+SAPI Image softGetImageResource(ImageHandle handle);
+SAPI void softUnloadImageResource(ImageHandle handle);
+SAPI void softPinImageResource(ImageHandle handle, bool pinned);
+SAPI void softSetImageBudget(u64 bytes);
+SAPI u64 softGetImageMemory(void);
+SAPI void softRegisterImage(Image* image);
 SAPI void softUnloadResources(void);
 
 // ------------------------------------------------------
 #pragma endregion
 // ------------------------------------------------------
 
+// ------------------------------------------------------
+#pragma region SOFT_FUNC_TILEMAP
+// ------------------------------------------------------
+
+SAPI Tilemap* softLoadTilemap(Atlas* atlas, const i32* tiles, iVec2 size, iVec2 tile_size, bool cached);
+SAPI void softSetTile(Tilemap* tilemap, iVec2 cell, i32 tile);
+SAPI i32 softGetTile(Tilemap* tilemap, iVec2 cell);
+SAPI void softInvalidateTilemap(Tilemap* tilemap);
+SAPI void softDrawTilemap(Tilemap* tilemap, iVec2 position, Pixel tint);
+SAPI void softUnloadTilemap(Tilemap* tilemap);
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
+// ------------------------------------------------------
+#pragma region SOFT_FUNC_RECORDING
+// ------------------------------------------------------
+
+SAPI i32 softBeginRecording(const string path);
+SAPI void softEndRecording(void);
+SAPI i32 softReplayRecording(const string path, f32* frame_times, i32 capacity);
+
+// ------------------------------------------------------
+#pragma endregion
+// ------------------------------------------------------
+
 #endif // SOFT_H
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "soft.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char** argv) {
+    if(argc < 3) {
+        fprintf(stderr, "Usage: %s <output.softpack> <image>...\n", argv[0]);
+        return SOFT_FAILED;
+    }
+
+    // Images are stored under the path they were given with, which is also the name to load them by.
+    i32 count = argc - 2;
+    Image* images = (Image*)calloc(count, sizeof(Image));
+    i32 result = images ? SOFT_SUCCESS : SOFT_FAILED;
+
+    for(i32 i = 0; i < count && result == SOFT_SUCCESS; i++) {
+        images[i] = softLoadImage(argv[i + 2]);
+
+        if(!images[i].data) {
+            result = SOFT_FAILED;
+        }
+    }
+
+    if(result == SOFT_SUCCESS) {
+        result = softSavePack(argv[1], argv + 2, images, count);
+    }
+
+    for(i32 i = 0; i < count && images; i++) {
+        if(images[i].data) {
+            softUnloadImage(&images[i]);
+        }
+    }
+
+    free(images);
+
+    return result;
+}